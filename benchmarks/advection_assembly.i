@@ -0,0 +1,109 @@
+# Element assembly micro-benchmark for HeatAdvectionConservative
+#
+# Only the advection kernel (and its flux BC) is active so that the
+# residual and Jacobian assembly times are dominated by the kernel.
+# The element type is selected from the command line, e.g.
+#
+#   ../teal-opt -i advection_assembly.i
+#   ../teal-opt -i advection_assembly.i Mesh/gen/dim=3 Mesh/gen/elem_type=HEX8
+#   ../teal-opt -i advection_assembly.i Mesh/gen/dim=3 Mesh/gen/elem_type=HEX27
+#
+# Use Kernels/heat_adv/upwinding_type=full to time the full upwinding loop.
+# Compare the 'residual_time' and 'jacobian_time' columns of the csv output
+# (or the perf graph printed at the end of the run) between two builds.
+
+[Mesh]
+  [./gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 40
+    ny = 40
+    nz = 10
+    xmax = 1
+    ymax = 1
+    zmax = 0.25
+    elem_type = QUAD4
+  [../]
+[]
+
+[Variables]
+  [./T]
+    initial_condition = 300 # K
+  [../]
+[]
+
+[AuxVariables]
+  [./rho]
+    initial_condition = 1000 # kg/m^3
+  [../]
+  [./cp]
+    initial_condition = 4000 # J/kg/K
+  [../]
+  [./ux]
+    initial_condition = 0.1 # m/s
+  [../]
+  [./uy]
+    initial_condition = 0.05 # m/s
+  [../]
+  [./uz]
+    initial_condition = 0.02 # m/s
+  [../]
+[]
+
+[Kernels]
+  [./heat_accum]
+    type = HeatAccumulation
+    variable = T
+    density = rho
+    heat_capacity = cp
+  [../]
+  [./heat_adv]
+    type = HeatAdvectionConservative
+    variable = T
+    density = rho
+    heat_capacity = cp
+    vel_x = ux
+    vel_y = uy
+    vel_z = uz
+    upwinding_type = 'none'
+  [../]
+[]
+
+[BCs]
+  [./fluxBCs]
+    type = ThermalFluidFluxBC
+    variable = T
+    boundary = 'left right'
+    density = rho
+    heat_capacity = cp
+    vel_x = ux
+    vel_y = uy
+    vel_z = uz
+    outside_temperature = 350
+  [../]
+[]
+
+!include perf_postprocessors.i
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  num_steps = 5
+  dt = 1.0
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'ilu'
+  nl_abs_tol = 1e-8
+[]
+
+[Outputs]
+  csv = true
+  perf_graph = true
+[]
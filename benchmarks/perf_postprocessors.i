@@ -0,0 +1,46 @@
+# Timing and iteration count postprocessors shared by the benchmark inputs.
+# Times are in seconds and are cumulative over the run.  The peak memory is in MB
+# (largest process).
+
+[Postprocessors]
+  [./wall_time]
+    type = PerfGraphData
+    section_name = 'Root'
+    data_type = TOTAL
+  [../]
+  [./residual_time]
+    type = PerfGraphData
+    section_name = 'FEProblem::computeResidualInternal'
+    data_type = TOTAL
+  [../]
+  [./jacobian_time]
+    type = PerfGraphData
+    section_name = 'FEProblem::computeJacobianInternal'
+    data_type = TOTAL
+  [../]
+  [./num_dofs]
+    type = NumDOFs
+  [../]
+  [./peak_memory]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+    mem_units = megabytes
+  [../]
+  [./nl_its]
+    type = NumNonlinearIterations
+    outputs = none
+  [../]
+  [./l_its]
+    type = NumLinearIterations
+    outputs = none
+  [../]
+  [./total_nl_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = nl_its
+  [../]
+  [./total_l_its]
+    type = CumulativeValuePostprocessor
+    postprocessor = l_its
+  [../]
+[]
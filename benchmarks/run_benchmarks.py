@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""Run the teal benchmark matrix and collect the timings into a single CSV file.
+
+Each case runs one of the benchmark inputs with command line overrides for
+the mesh refinement, dimension, model, upwinding, and number of threads.  The last row of the
+case's postprocessor CSV holds the cumulative timings (from PerfGraph) and
+iteration counts, and is appended to the results file together with the case
+parameters.
+
+Example:
+    ./run_benchmarks.py --exec ../teal-opt -n 4 --refine 0 1 2 -o results.csv
+
+Memory footprint of the property fields (nodal AuxVariables against per element floats):
+    ./run_benchmarks.py --models single compact --refine 2 3 4 -o memory.csv
+
+Threaded save_in scaling (the save_in model, full upwinding):
+    ./run_benchmarks.py --models save_in --upwinding full --dims 2D \
+        --threads 1 2 4 8 16 32 --save-in none save_in tagged -o threads.csv
+"""
+
+import argparse
+import csv
+import itertools
+import os
+import shutil
+import subprocess
+import sys
+import time
+
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+
+# Benchmark input for each model
+MODELS = {'single': 'thermal_fluid.i', 'two_temperature': 'two_temperature.i',
+          'save_in': 'save_in_threading.i', 'compact': 'compact_properties.i'}
+
+# Default models (the save_in and compact models are only run when asked for)
+DEFAULT_MODELS = ['single', 'two_temperature']
+
+# Command line overrides for each way of copying the advection residual (save_in model only)
+SAVE_IN = {'none': [],
+           'save_in': ['Kernels/heat_adv/save_in=adv_res'],
+           'tagged': ['Kernels/heat_adv/extra_vector_tags=adv_tag']}
+
+# Command line overrides for each mesh dimension
+DIMS = {'2D': [], '3D': ['Mesh/gen/dim=3', 'Mesh/gen/elem_type=HEX8']}
+
+# Columns read from the postprocessor CSV of each case
+COLUMNS = ['num_dofs', 'wall_time', 'residual_time', 'jacobian_time', 'total_nl_its',
+           'total_l_its', 'peak_memory']
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--exec', dest='executable',
+                        default=os.path.join(BENCH_DIR, '..', 'teal-opt'),
+                        help='teal executable (default: ../teal-opt)')
+    parser.add_argument('-n', '--np', type=int, default=1,
+                        help='number of MPI processes (default: 1)')
+    parser.add_argument('--mpiexec', default='mpiexec', help='MPI launcher (default: mpiexec)')
+    parser.add_argument('--refine', type=int, nargs='+', default=[0, 1, 2],
+                        help='uniform refinement levels (default: 0 1 2)')
+    parser.add_argument('--dims', nargs='+', choices=DIMS.keys(), default=list(DIMS.keys()))
+    parser.add_argument('--models', nargs='+', choices=MODELS.keys(), default=DEFAULT_MODELS)
+    parser.add_argument('--upwinding', nargs='+', choices=['none', 'full'],
+                        default=['none', 'full'])
+    parser.add_argument('--threads', type=int, nargs='+', default=[1],
+                        help='numbers of threads per process (default: 1)')
+    parser.add_argument('--save-in', nargs='+', choices=SAVE_IN.keys(), default=['none'],
+                        help='residual copies for the save_in model (default: none)')
+    parser.add_argument('--repeat', type=int, default=1,
+                        help='number of runs of each case (default: 1)')
+    parser.add_argument('--work-dir', default=os.path.join(BENCH_DIR, 'runs'),
+                        help='directory for the output of each run (default: ./runs)')
+    parser.add_argument('-o', '--output', default='benchmark_results.csv',
+                        help='results CSV file (default: benchmark_results.csv)')
+    parser.add_argument('--label', default='',
+                        help='label stored with every row (e.g. a release tag or git hash)')
+    parser.add_argument('--dry-run', action='store_true',
+                        help='print the commands without running them')
+    return parser.parse_args()
+
+
+def last_row(csv_file):
+    """Returns the last row of a MOOSE postprocessor CSV file as a dict"""
+    with open(csv_file, newline='') as f:
+        rows = list(csv.DictReader(f))
+    if not rows:
+        raise RuntimeError('no data in ' + csv_file)
+    return rows[-1]
+
+
+def run_case(args, model, dim, upwinding, refine, threads, save_in, run):
+    name = '{}_{}_{}_r{}_t{}_{}_{}'.format(model, dim, upwinding, refine, threads, save_in, run)
+    file_base = os.path.join(args.work_dir, name)
+    cmd = []
+    if args.np > 1:
+        cmd += [args.mpiexec, '-n', str(args.np)]
+    cmd += [args.executable, '-i', os.path.join(BENCH_DIR, MODELS[model])]
+    if threads > 1:
+        cmd += ['--n-threads={}'.format(threads)]
+    cmd += DIMS[dim]
+    cmd += SAVE_IN[save_in]
+    cmd += ['Mesh/uniform_refine={}'.format(refine),
+            'Kernels/heat_adv/upwinding_type={}'.format(upwinding),
+            'Outputs/file_base={}'.format(file_base)]
+
+    print(' '.join(cmd), flush=True)
+    if args.dry_run:
+        return None
+
+    start = time.time()
+    with open(file_base + '.log', 'w') as log:
+        proc = subprocess.run(cmd, stdout=log, stderr=subprocess.STDOUT)
+    elapsed = time.time() - start
+
+    row = {'label': args.label, 'model': model, 'dim': dim, 'upwinding': upwinding,
+           'refine': refine, 'run': run, 'np': args.np, 'threads': threads,
+           'save_in': save_in, 'status': proc.returncode,
+           'elapsed': '{:.3f}'.format(elapsed)}
+    if proc.returncode == 0:
+        data = last_row(file_base + '.csv')
+        row.update({c: data.get(c, '') for c in COLUMNS})
+    else:
+        print('  FAILED (see {}.log)'.format(file_base), file=sys.stderr)
+    return row
+
+
+def main():
+    args = parse_args()
+    if not args.dry_run and shutil.which(args.executable) is None:
+        sys.exit('teal executable not found: ' + args.executable)
+    os.makedirs(args.work_dir, exist_ok=True)
+
+    fields = ['label', 'model', 'dim', 'upwinding', 'refine', 'run', 'np', 'threads', 'save_in',
+              'status', 'elapsed']
+    fields += COLUMNS
+
+    rows = []
+    for model, dim, upwinding, refine, threads, run in itertools.product(
+            args.models, args.dims, args.upwinding, args.refine, args.threads,
+            range(args.repeat)):
+        for save_in in (args.save_in if model == 'save_in' else ['none']):
+            row = run_case(args, model, dim, upwinding, refine, threads, save_in, run)
+            if row is not None:
+                rows.append(row)
+
+    if args.dry_run:
+        return 0
+
+    write_header = not os.path.exists(args.output)
+    with open(args.output, 'a', newline='') as f:
+        writer = csv.DictWriter(f, fieldnames=fields)
+        if write_header:
+            writer.writeheader()
+        writer.writerows(rows)
+    print('Wrote {} rows to {}'.format(len(rows), args.output))
+    return 0 if all(r['status'] == 0 for r in rows) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,131 @@
+# Threaded save_in benchmark: the thermal_fluid.i case with the advection
+# residual copied into an auxiliary variable.
+#
+# Base case: 2D, 100 x 10 QUAD4, full upwinding, no copy.  The copy is switched
+# on from the command line (see run_benchmarks.py --save-in), e.g.
+#
+#   Kernels/heat_adv/save_in=adv_res                         # save_in
+#   Kernels/heat_adv/extra_vector_tags=adv_tag               # tagged vector
+#
+# and the number of threads is set with --n-threads=N.  With save_in every
+# element takes the global spin mutex; the tagged vector goes through the
+# thread local residual cache of MOOSE and is copied once by TagVectorAux.
+#
+# The postprocessors report the timings and iteration counts used by the
+# benchmark driver.  Values are cumulative over the run.
+
+[Mesh]
+  [./gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 100
+    ny = 10
+    nz = 10
+    xmax = 1
+    ymax = 0.1
+    zmax = 0.1
+  [../]
+[]
+
+[Problem]
+  extra_tag_vectors = 'adv_tag'
+[]
+
+[Variables]
+  [./T]
+    initial_condition = 300 # K
+  [../]
+[]
+
+[AuxVariables]
+  [./rho]
+    initial_condition = 1000 # kg/m^3
+  [../]
+  [./cp]
+    initial_condition = 4000 # J/kg/K
+  [../]
+  [./K]
+    initial_condition = 0.6 # W/m/K
+  [../]
+  [./ux]
+    initial_condition = 0.01 # m/s
+  [../]
+  [./adv_res]
+  [../]
+  [./adv_res_tagged]
+  [../]
+[]
+
+[AuxKernels]
+  # Only non-zero when the tag is given to heat_adv
+  [./adv_res_tagged]
+    type = TagVectorAux
+    variable = adv_res_tagged
+    v = T
+    vector_tag = 'adv_tag'
+    execute_on = 'timestep_end'
+  [../]
+[]
+
+[Kernels]
+  [./heat_accum]
+    type = HeatAccumulation
+    variable = T
+    density = rho
+    heat_capacity = cp
+  [../]
+  [./heat_cond]
+    type = HeatConduction
+    variable = T
+    thermal_conductivity = K
+  [../]
+  [./heat_adv]
+    type = HeatAdvectionConservative
+    variable = T
+    density = rho
+    heat_capacity = cp
+    vel_x = ux
+    upwinding_type = 'full'
+  [../]
+[]
+
+[BCs]
+  [./fluxBCs]
+    type = ThermalFluidFluxBC
+    variable = T
+    boundary = 'left right'
+    density = rho
+    heat_capacity = cp
+    vel_x = ux
+    outside_temperature = 350
+  [../]
+[]
+
+!include perf_postprocessors.i
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+    solve_type = pjfnk
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  num_steps = 10
+  dt = 1.0
+  petsc_options_iname = '-ksp_type -pc_type -sub_pc_type -sub_pc_factor_shift_type'
+  petsc_options_value = 'gmres asm ilu NONZERO'
+  line_search = none
+  nl_rel_tol = 1e-8
+  nl_abs_tol = 1e-8
+  l_tol = 1e-6
+  l_max_its = 300
+[]
+
+[Outputs]
+  csv = true
+  perf_graph = true
+[]
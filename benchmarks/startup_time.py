@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""Compare the startup time and binary size of teal executables.
+
+Each executable runs an input with --check-input, which builds the app,
+registers its objects and sets up the problem, but does not solve it. This
+is the fixed cost paid by every short job. The binary size is the size of
+the executable plus the shared libraries it links from MOOSE and teal (the
+system, PETSc and libMesh libraries are shared by both builds and left out).
+
+Example (lean build made with 'make TEAL_LEAN=yes' in a second work tree):
+    ./startup_time.py --exec ../teal-opt ../../teal-lean/teal-opt --repeat 20
+"""
+
+import argparse
+import os
+import statistics
+import subprocess
+import sys
+import time
+
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--exec', dest='executables', nargs='+',
+                        default=[os.path.join(BENCH_DIR, '..', 'teal-opt')],
+                        help='teal executables to compare (default: ../teal-opt)')
+    parser.add_argument('-i', '--input', default=os.path.join(BENCH_DIR, 'thermal_fluid.i'),
+                        help='input file to check (default: thermal_fluid.i)')
+    parser.add_argument('--repeat', type=int, default=10,
+                        help='number of runs of each executable (default: 10)')
+    return parser.parse_args()
+
+
+def linked_size(executable):
+    """Size (bytes) of the executable and the MOOSE and teal libraries it links"""
+    size = os.path.getsize(executable)
+    ldd = subprocess.run(['ldd', executable], capture_output=True, text=True, check=True)
+    for line in ldd.stdout.splitlines():
+        # Lines look like: libmoose-opt.so.0 => /path/libmoose-opt.so.0 (0x...)
+        parts = line.split('=>')
+        if len(parts) != 2:
+            continue
+        path = parts[1].split('(')[0].strip()
+        name = os.path.basename(path)
+        if path and any(key in name for key in ('moose', 'teal', 'modules', 'hit', 'pcre')):
+            size += os.path.getsize(os.path.realpath(path))
+    return size
+
+
+def startup_times(executable, input_file, repeat):
+    """Wall times (s) of 'repeat' runs of the executable with --check-input"""
+    times = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        subprocess.run([executable, '-i', input_file, '--check-input'], stdout=subprocess.DEVNULL,
+                       stderr=subprocess.DEVNULL, check=True, cwd=BENCH_DIR)
+        times.append(time.perf_counter() - start)
+    return times
+
+
+def main():
+    args = parse_args()
+    print('{:<40} {:>12} {:>12} {:>12}'.format('executable', 'size (MB)', 'min (s)',
+                                               'median (s)'))
+    for executable in args.executables:
+        if not os.path.isfile(executable):
+            sys.exit('Executable not found: ' + executable)
+        times = startup_times(executable, args.input, args.repeat)
+        print('{:<40} {:>12.1f} {:>12.3f} {:>12.3f}'.format(
+            os.path.basename(executable), linked_size(executable) / 1e6, min(times),
+            statistics.median(times)))
+
+
+if __name__ == '__main__':
+    main()
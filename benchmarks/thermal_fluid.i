@@ -0,0 +1,108 @@
+# Scalable single-temperature thermal fluid benchmark
+#
+# Base case: 2D, 100 x 10 QUAD4, no upwinding.  Parameters are varied from the
+# command line (see run_benchmarks.py), e.g.
+#
+#   Mesh/uniform_refine=2                                  # mesh refinement
+#   Mesh/gen/dim=3 Mesh/gen/elem_type=HEX8                 # 3D
+#   Kernels/heat_adv/upwinding_type=full                   # full upwinding
+#
+# The postprocessors report the timings and iteration counts used by the
+# benchmark driver.  Values are cumulative over the run.
+
+[Mesh]
+  [./gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 100
+    ny = 10
+    nz = 10
+    xmax = 1
+    ymax = 0.1
+    zmax = 0.1
+  [../]
+[]
+
+[Variables]
+  [./T]
+    initial_condition = 300 # K
+  [../]
+[]
+
+[AuxVariables]
+  [./rho]
+    initial_condition = 1000 # kg/m^3
+  [../]
+  [./cp]
+    initial_condition = 4000 # J/kg/K
+  [../]
+  [./K]
+    initial_condition = 0.6 # W/m/K
+  [../]
+  [./ux]
+    initial_condition = 0.01 # m/s
+  [../]
+[]
+
+[Kernels]
+  [./heat_accum]
+    type = HeatAccumulation
+    variable = T
+    density = rho
+    heat_capacity = cp
+  [../]
+  [./heat_cond]
+    type = HeatConduction
+    variable = T
+    thermal_conductivity = K
+  [../]
+  [./heat_adv]
+    type = HeatAdvectionConservative
+    variable = T
+    density = rho
+    heat_capacity = cp
+    vel_x = ux
+    upwinding_type = 'none'
+  [../]
+[]
+
+[BCs]
+  [./fluxBCs]
+    type = ThermalFluidFluxBC
+    variable = T
+    boundary = 'left right'
+    density = rho
+    heat_capacity = cp
+    vel_x = ux
+    outside_temperature = 350
+  [../]
+[]
+
+!include perf_postprocessors.i
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+    solve_type = pjfnk
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  num_steps = 10
+  dt = 1.0
+  petsc_options_iname = '-ksp_type -pc_type -sub_pc_type -sub_pc_factor_shift_type'
+  petsc_options_value = 'gmres asm ilu NONZERO'
+  line_search = none
+  nl_rel_tol = 1e-8
+  nl_abs_tol = 1e-8
+  l_tol = 1e-6
+  l_max_its = 300
+[]
+
+[Outputs]
+  csv = true
+  perf_graph = true
+[]
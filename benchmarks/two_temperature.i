@@ -0,0 +1,155 @@
+# Scalable two-temperature (fluid/solid) thermal fluid benchmark
+#
+# Base case: 2D, 100 x 10 QUAD4, no upwinding.  Parameters are varied from the
+# command line in the same way as thermal_fluid.i, e.g.
+#
+#   Mesh/uniform_refine=2 Kernels/heat_adv/upwinding_type=full
+
+[Mesh]
+  [./gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 100
+    ny = 10
+    nz = 10
+    xmax = 1
+    ymax = 0.1
+    zmax = 0.1
+  [../]
+[]
+
+[Variables]
+  [./Tf]
+    initial_condition = 300 # K
+  [../]
+  [./Ts]
+    initial_condition = 300 # K
+  [../]
+[]
+
+[AuxVariables]
+  [./rho_f]
+    initial_condition = 1.2 # kg/m^3
+  [../]
+  [./cp_f]
+    initial_condition = 1000 # J/kg/K
+  [../]
+  [./K_f]
+    initial_condition = 0.025 # W/m/K
+  [../]
+  [./rho_s]
+    initial_condition = 7750 # kg/m^3
+  [../]
+  [./cp_s]
+    initial_condition = 466 # J/kg/K
+  [../]
+  [./K_s]
+    initial_condition = 45 # W/m/K
+  [../]
+  [./eps]
+    initial_condition = 0.4 # fluid volume fraction (-)
+  [../]
+  [./eps_s]
+    initial_condition = 0.6 # solid volume fraction (-)
+  [../]
+  [./ux]
+    initial_condition = 1.0 # m/s
+  [../]
+[]
+
+[Kernels]
+  [./fluid_accum]
+    type = HeatAccumulation
+    variable = Tf
+    density = rho_f
+    heat_capacity = cp_f
+    volume_frac = eps
+  [../]
+  [./fluid_cond]
+    type = HeatConduction
+    variable = Tf
+    thermal_conductivity = K_f
+    volume_frac = eps
+  [../]
+  [./heat_adv]
+    type = HeatAdvectionConservative
+    variable = Tf
+    density = rho_f
+    heat_capacity = cp_f
+    volume_frac = eps
+    vel_x = ux
+    upwinding_type = 'none'
+  [../]
+  [./fluid_conv]
+    type = HeatConvection
+    variable = Tf
+    coupled_temperature = Ts
+    convection_coeff = 50
+    specific_area = 500
+    volume_frac = eps_s
+  [../]
+
+  [./solid_accum]
+    type = HeatAccumulation
+    variable = Ts
+    density = rho_s
+    heat_capacity = cp_s
+    volume_frac = eps_s
+  [../]
+  [./solid_cond]
+    type = HeatConduction
+    variable = Ts
+    thermal_conductivity = K_s
+    volume_frac = eps_s
+  [../]
+  [./solid_conv]
+    type = HeatConvection
+    variable = Ts
+    coupled_temperature = Tf
+    convection_coeff = 50
+    specific_area = 500
+    volume_frac = eps_s
+  [../]
+[]
+
+[BCs]
+  [./fluxBCs]
+    type = ThermalFluidFluxBC
+    variable = Tf
+    boundary = 'left right'
+    density = rho_f
+    heat_capacity = cp_f
+    volume_frac = eps
+    vel_x = ux
+    outside_temperature = 350
+  [../]
+[]
+
+!include perf_postprocessors.i
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+    solve_type = pjfnk
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  num_steps = 10
+  dt = 1.0
+  petsc_options_iname = '-ksp_type -pc_type -sub_pc_type -sub_pc_factor_shift_type'
+  petsc_options_value = 'gmres asm ilu NONZERO'
+  line_search = none
+  nl_rel_tol = 1e-8
+  nl_abs_tol = 1e-8
+  l_tol = 1e-6
+  l_max_its = 300
+[]
+
+[Outputs]
+  csv = true
+  perf_graph = true
+[]
@@ -0,0 +1,49 @@
+/*!
+ *  \file ExchangedHeatAux.h
+ *  \brief AuxKernel for the cumulative energy exchanged with a phase of another app
+ *  \details This file creates an auxiliary kernel that sums, over the time steps of a
+ *            sub-cycled app, the energy per volume given by the other phase to this
+ *            phase through TransferredHeatExchange:
+ *                  E = E_old + dt * hA * (T_other - T)
+ *                          where hA = h * A * fv (W/K/m^3)
+ *                          T = temperature of this phase at the end of the step (K)
+ *                          T_other = transferred temperature of the other phase (K)
+ *
+ *            The variable must be CONSTANT MONOMIAL. Its value is then the average of
+ *            dt * hA * (T_other - T) over each element, integrated at the same quadrature
+ *            points as the kernel, so that with implicit Euler the energy of each element is
+ *            exactly the exchange that the kernel applied over the step (nodal values of the
+ *            product would not be). Executed at timestep_end and transferred back to
+ *            the app of the other phase, the difference of E over one of its (long) steps is
+ *            the energy that crossed the interface during all the sub-cycles, which that
+ *            app removes with TransferredHeatExchange ('exchanged_energy').
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "AuxKernel.h"
+
+/// ExchangedHeatAux class object inherits from AuxKernel object
+/** Cumulative energy per volume received from the other phase (J/m^3). */
+class ExchangedHeatAux : public AuxKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ExchangedHeatAux(const InputParameters & parameters);
+
+protected:
+  /// Required MOOSE function override
+  virtual Real computeValue() override;
+
+  const VariableValue & _energy_old; ///< Cumulative exchanged energy at the previous step
+  const VariableValue & _temp;       ///< Temperature of this phase (K)
+  const VariableValue & _other_temp; ///< Transferred temperature of the other phase (K)
+  const VariableValue & _hA;         ///< Variable for h * A * fv (W/K/m^3)
+};
@@ -0,0 +1,59 @@
+/*!
+ *  \file TealOffDiagonalInterface.h
+ *  \brief Interface for skipping off diagonal Jacobian blocks of non-coupled variables
+ *  \details This file creates an interface that teal kernels and boundary conditions
+ *            inherit to find, at initial setup, which of their coupled variables are
+ *            nonlinear variables. The property and velocity inputs are normally
+ *            auxiliary variables or constants, so most off diagonal Jacobian blocks
+ *            requested by the assembly (e.g., with 'SMP full = true') are known to be
+ *            zero. The objects skip those blocks entirely instead of looping over the
+ *            quadrature points only to add zeros.
+ *
+ *  \note The sparsity pattern of the Jacobian is set by the preconditioner block,
+ *          not by the kernels. To also save matrix memory, use 'full = false' with
+ *          'off_diag_row'/'off_diag_column' for only the nonlinear couplings.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This interface was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "Coupleable.h"
+
+#include <vector>
+
+class SystemBase;
+
+/// TealOffDiagonalInterface class object
+/** Tracks which coupled variables of an object give non-zero off diagonal Jacobian blocks. */
+class TealOffDiagonalInterface
+{
+public:
+  /// Constructor takes the object using this interface, its system, and its variable number
+  TealOffDiagonalInterface(const Coupleable * coupleable,
+                           const SystemBase & sys,
+                           const unsigned int var_num);
+
+protected:
+  /// Finds the coupled variables that are in the same (nonlinear) system as the object
+  /** Must be called from initialSetup() of the object. */
+  void findNonlinearCoupledVariables();
+
+  /// True if jvar is the object's own variable or a nonlinear coupled variable
+  bool hasOffDiagonalBlock(const unsigned int jvar) const
+  {
+    return jvar == _off_diag_var_num || (jvar < _nl_coupled.size() && _nl_coupled[jvar]);
+  }
+
+private:
+  /// Object using this interface
+  const Coupleable & _off_diag_coupleable;
+  /// System of the object's variable
+  const SystemBase & _off_diag_sys;
+  /// Number of the object's variable
+  const unsigned int _off_diag_var_num;
+  /// Flags for the variables of the system that are coupled to the object
+  std::vector<bool> _nl_coupled;
+};
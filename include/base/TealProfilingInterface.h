@@ -0,0 +1,100 @@
+/*!
+ *  \file TealProfilingInterface.h
+ *  \brief Interface for optional PerfGraph timing and work counters in teal objects
+ *  \details This file creates an interface that teal kernels and boundary conditions
+ *            inherit to (optionally) time their residual and Jacobian paths with
+ *            PerfGraph sections and to count the work they do (elements visited,
+ *            upwind and downwind nodes). Everything is off by default, and is
+ *            turned on per object with 'profile = true'. The counters are read by
+ *            the TealWorkCounter postprocessor. The residual and Jacobian methods of the
+ *            objects only construct a ProfileScope, which counts the call and times its
+ *            section. The PerfGraph sections are only registered when profiling.
+ *
+ *  \note PerfGraph is not thread safe, so the timed sections are only active when
+ *          running with a single thread. The counters are kept per thread copy of the
+ *          object and are summed by TealWorkCounter.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This interface was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "MooseObject.h"
+#include "PerfGuard.h"
+
+#include <array>
+#include <optional>
+
+/// TealProfilingInterface class object
+/** Adds the 'profile' parameter, PerfGraph sections, and work counters to an object. */
+class TealProfilingInterface
+{
+public:
+  /// Parameters to add to the validParams of the object using this interface
+  static InputParameters validParams();
+
+  /// Constructor takes the object using this interface
+  TealProfilingInterface(const MooseObject * moose_object);
+
+  /// Work counters kept by the objects (order must match TealWorkCounter's 'counter' enum)
+  enum class Counter : unsigned int
+  {
+    residual_calls = 0, ///< Number of element (or side) residual evaluations
+    jacobian_calls,     ///< Number of element (or side) Jacobian evaluations
+    upwind_nodes,       ///< Number of upwind nodes visited by full upwinding
+    downwind_nodes      ///< Number of downwind nodes visited by full upwinding
+  };
+
+  /// True if profiling was requested for this object
+  bool profiling() const { return _profile; }
+
+  /// Returns the value of a work counter for this (thread copy of the) object
+  unsigned long long counter(Counter c) const { return _counters[static_cast<unsigned int>(c)]; }
+
+protected:
+  /// PerfGraph sections registered for every object using this interface
+  enum class Section : unsigned int
+  {
+    residual = 0,     ///< computeResidual
+    jacobian,         ///< computeJacobian
+    off_diag_jacobian ///< computeOffDiagJacobian
+  };
+
+  /// Counts the call and times a section (if enabled) until it goes out of scope
+  class ProfileScope
+  {
+  public:
+    /// Counts a residual or Jacobian call and times the matching section of the object
+    ProfileScope(TealProfilingInterface & object, Section section);
+
+    /// Times a section registered by the object through registerProfileSection
+    ProfileScope(const TealProfilingInterface & object, const PerfID id);
+
+  private:
+    std::optional<PerfGuard> _guard; ///< Times the section while in scope (if enabled)
+  };
+
+  /// Registers a PerfGraph section named '<type>::<name>::<section_name>' (only when profiling)
+  PerfID registerProfileSection(const std::string & section_name) const;
+
+  /// Adds n to a work counter (only when profiling)
+  void incrementCounter(Counter c, unsigned long long n = 1)
+  {
+    if (_profile)
+      _counters[static_cast<unsigned int>(c)] += n;
+  }
+
+private:
+  /// Object using this interface
+  const MooseObject & _profile_object;
+  /// True if profiling was requested for this object
+  const bool _profile;
+  /// True if the PerfGraph sections are active (profiling with a single thread)
+  const bool _profile_timing;
+  /// Sections for the residual and Jacobian methods, indexed by Section
+  const std::array<PerfID, 3> _sections;
+  /// Work counters, indexed by Counter
+  std::array<unsigned long long, 4> _counters;
+};
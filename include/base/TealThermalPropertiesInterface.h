@@ -0,0 +1,313 @@
+/*!
+ *  \file TealThermalPropertiesInterface.h
+ *  \brief Interface for the fv * rho * cp and fv * K inputs shared by the teal objects
+ *  \details This file creates the parameters and an interface that teal kernels, boundary
+ *            conditions, indicators, and postprocessors use to read the volumetric heat
+ *            capacity (fv * rho * cp) and the effective thermal conductivity (fv * K).
+ *            Each product is either built from the coupled variables ('density',
+ *            'heat_capacity', 'thermal_conductivity', and 'volume_frac') or given by a
+ *            material property ('rho_cp_eps' or 'k_eps'). An object adds the parameters
+ *            of the products it uses with TealThermalProperties::capacityParams and
+ *            TealThermalProperties::conductivityParams, and inherits the interface in
+ *            place of its MOOSE base class (as with DerivativeMaterialInterface).
+ *
+ *            The interface checks the combination of inputs, evaluates both products at
+ *            the current quadrature point, and gives their derivatives with respect to
+ *            the coupled variables (for the off diagonal Jacobians) and the temperature
+ *            derivatives declared by the materials. The AD objects inherit
+ *            TealADThermalPropertiesInterface instead, which takes the same parameters and
+ *            evaluates both products as ADReal from the AD coupled values and AD material
+ *            properties, so AD carries all of their derivatives.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This interface was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "InputParameters.h"
+#include "MaterialProperty.h"
+#include "MooseTypes.h"
+
+#include "libmesh/libmesh_common.h"
+
+class MooseObject;
+
+/// Parameters of the objects using TealThermalPropertiesInterface
+namespace TealThermalProperties
+{
+/// Parameters for fv * rho * cp: 'density', 'heat_capacity', 'volume_frac', and 'rho_cp_eps'
+/** required: 'rho_cp_eps' or both 'density' and 'heat_capacity' must be given
+    jacobian: the temperature derivative of 'rho_cp_eps' is added to the Jacobian */
+InputParameters capacityParams(const bool required, const bool jacobian);
+
+/// Parameters for fv * K: 'thermal_conductivity', 'volume_frac', and 'k_eps'
+/** required: 'k_eps' or 'thermal_conductivity' must be given
+    jacobian: the temperature derivative of 'k_eps' is added to the Jacobian */
+InputParameters conductivityParams(const bool required, const bool jacobian);
+
+/// Checks the combination of inputs given to an object with the parameters above
+void checkInputs(const MooseObject & object);
+}
+
+/// TealThermalPropertiesInterface class object
+/** Inherited in place of the MOOSE base class T. Reads fv * rho * cp if the object added the
+    capacityParams, and fv * K if it added the conductivityParams. */
+template <class T>
+class TealThermalPropertiesInterface : public T
+{
+public:
+  /// Constructor with the parameters of the object
+  TealThermalPropertiesInterface(const InputParameters & parameters);
+
+protected:
+  /// fv * rho * cp at the current quadrature point (J/m^3/K)
+  Real rhoCpEpsQp() const;
+
+  /// fv * K at the current quadrature point (W/m/K)
+  Real kEpsQp() const;
+
+  /// d(fv * rho * cp)/d(jvar) at the current quadrature point (zero with 'rho_cp_eps')
+  Real dRhoCpEpsCoupledQp(const unsigned int jvar) const;
+
+  /// d(fv * K)/d(jvar) at the current quadrature point (zero with 'k_eps')
+  Real dKEpsCoupledQp(const unsigned int jvar) const;
+
+  /// Derivative of 'rho_cp_eps' with respect to var (nullptr without the material)
+  /** Requires T to be a DerivativeMaterialInterface. The derivative is zero unless the
+      material declares it. */
+  const MaterialProperty<Real> * rhoCpEpsDerivative(const VariableName & var);
+
+  /// Derivative of 'k_eps' with respect to var (nullptr without the material)
+  const MaterialProperty<Real> * kEpsDerivative(const VariableName & var);
+
+  const bool _use_rho_cp_eps; ///< True if fv * rho * cp is given by a material property
+  const bool _use_k_eps;      ///< True if fv * K is given by a material property
+
+  /// Volume fraction variable (-), for objects that also use fv outside of the products
+  const VariableValue & _volfrac;
+
+private:
+  /// Coupled variable value, or nullptr if the object did not add the parameter
+  const VariableValue * coupledValueIfAdded(const std::string & name, const bool added);
+
+  /// Coupled variable number, or invalid_uint if the object did not add the parameter
+  unsigned int coupledIfAdded(const std::string & name, const bool added);
+
+  const bool _has_capacity;     ///< True if the object added the capacityParams
+  const bool _has_conductivity; ///< True if the object added the conductivityParams
+
+  const VariableValue * const _density;      ///< Density variable (kg/m^3)
+  const unsigned int _density_var;           ///< Variable identification for density
+  const VariableValue * const _heat_cap;     ///< Heat capacity variable (J/kg/K)
+  const unsigned int _heat_cap_var;          ///< Variable identification for heat capacity
+  const VariableValue * const _conductivity; ///< Thermal conductivity variable (W/m/K)
+  const unsigned int _conductivity_var;      ///< Variable identification for the conductivity
+  const unsigned int _volfrac_var;           ///< Variable identification for volume fraction
+
+  const MaterialProperty<Real> * const _rho_cp_eps; ///< Material property for fv * rho * cp
+  const MaterialProperty<Real> * const _k_eps;      ///< Material property for fv * K (W/m/K)
+};
+
+template <class T>
+TealThermalPropertiesInterface<T>::TealThermalPropertiesInterface(
+    const InputParameters & parameters)
+  : T(parameters),
+    _use_rho_cp_eps(this->isParamValid("rho_cp_eps")),
+    _use_k_eps(this->isParamValid("k_eps")),
+    _volfrac(this->coupledValue("volume_frac")),
+    _has_capacity(parameters.have_parameter<MaterialPropertyName>("rho_cp_eps")),
+    _has_conductivity(parameters.have_parameter<MaterialPropertyName>("k_eps")),
+    _density(coupledValueIfAdded("density", _has_capacity)),
+    _density_var(coupledIfAdded("density", _has_capacity)),
+    _heat_cap(coupledValueIfAdded("heat_capacity", _has_capacity)),
+    _heat_cap_var(coupledIfAdded("heat_capacity", _has_capacity)),
+    _conductivity(coupledValueIfAdded("thermal_conductivity", _has_conductivity)),
+    _conductivity_var(coupledIfAdded("thermal_conductivity", _has_conductivity)),
+    _volfrac_var(this->coupled("volume_frac")),
+    _rho_cp_eps(_use_rho_cp_eps ? &this->template getMaterialProperty<Real>("rho_cp_eps")
+                                : nullptr),
+    _k_eps(_use_k_eps ? &this->template getMaterialProperty<Real>("k_eps") : nullptr)
+{
+  TealThermalProperties::checkInputs(*this);
+}
+
+template <class T>
+const VariableValue *
+TealThermalPropertiesInterface<T>::coupledValueIfAdded(const std::string & name,
+                                                       const bool added)
+{
+  return added ? &this->coupledValue(name) : nullptr;
+}
+
+template <class T>
+unsigned int
+TealThermalPropertiesInterface<T>::coupledIfAdded(const std::string & name, const bool added)
+{
+  return added ? this->coupled(name) : libMesh::invalid_uint;
+}
+
+template <class T>
+Real
+TealThermalPropertiesInterface<T>::rhoCpEpsQp() const
+{
+  const unsigned int qp = this->_qp;
+  if (_use_rho_cp_eps)
+    return (*_rho_cp_eps)[qp];
+  return (*_density)[qp] * (*_heat_cap)[qp] * _volfrac[qp];
+}
+
+template <class T>
+Real
+TealThermalPropertiesInterface<T>::kEpsQp() const
+{
+  const unsigned int qp = this->_qp;
+  if (_use_k_eps)
+    return (*_k_eps)[qp];
+  return (*_conductivity)[qp] * _volfrac[qp];
+}
+
+template <class T>
+Real
+TealThermalPropertiesInterface<T>::dRhoCpEpsCoupledQp(const unsigned int jvar) const
+{
+  if (!_has_capacity || _use_rho_cp_eps)
+    return 0.0;
+
+  // Summed, in case the same variable is coupled to more than one input
+  const unsigned int qp = this->_qp;
+  Real d = 0.0;
+  if (jvar == _density_var)
+    d += (*_heat_cap)[qp] * _volfrac[qp];
+  if (jvar == _heat_cap_var)
+    d += (*_density)[qp] * _volfrac[qp];
+  if (jvar == _volfrac_var)
+    d += (*_density)[qp] * (*_heat_cap)[qp];
+  return d;
+}
+
+template <class T>
+Real
+TealThermalPropertiesInterface<T>::dKEpsCoupledQp(const unsigned int jvar) const
+{
+  if (!_has_conductivity || _use_k_eps)
+    return 0.0;
+
+  const unsigned int qp = this->_qp;
+  Real d = 0.0;
+  if (jvar == _conductivity_var)
+    d += _volfrac[qp];
+  if (jvar == _volfrac_var)
+    d += (*_conductivity)[qp];
+  return d;
+}
+
+template <class T>
+const MaterialProperty<Real> *
+TealThermalPropertiesInterface<T>::rhoCpEpsDerivative(const VariableName & var)
+{
+  return _use_rho_cp_eps
+             ? &this->template getMaterialPropertyDerivative<Real>("rho_cp_eps", var)
+             : nullptr;
+}
+
+template <class T>
+const MaterialProperty<Real> *
+TealThermalPropertiesInterface<T>::kEpsDerivative(const VariableName & var)
+{
+  return _use_k_eps ? &this->template getMaterialPropertyDerivative<Real>("k_eps", var)
+                    : nullptr;
+}
+
+/// TealADThermalPropertiesInterface class object
+/** AD version of TealThermalPropertiesInterface, inherited in place of the MOOSE AD base class
+    T. Takes the same parameters, and reads fv * rho * cp and fv * K as ADReal. */
+template <class T>
+class TealADThermalPropertiesInterface : public T
+{
+public:
+  /// Constructor with the parameters of the object
+  TealADThermalPropertiesInterface(const InputParameters & parameters);
+
+protected:
+  /// fv * rho * cp at the current quadrature point (J/m^3/K)
+  ADReal rhoCpEpsQp() const;
+
+  /// fv * K at the current quadrature point (W/m/K)
+  ADReal kEpsQp() const;
+
+  const bool _use_rho_cp_eps; ///< True if fv * rho * cp is given by a material property
+  const bool _use_k_eps;      ///< True if fv * K is given by a material property
+
+  /// Volume fraction variable (-), for objects that also use fv outside of the products
+  const ADVariableValue & _volfrac;
+
+private:
+  /// AD coupled variable value, or nullptr if the object did not add the parameter
+  const ADVariableValue * adCoupledValueIfAdded(const std::string & name, const bool added);
+
+  /// AD material property, or nullptr unless the object was given the parameter
+  const ADMaterialProperty<Real> * adMaterialPropertyIfValid(const std::string & name);
+
+  const ADVariableValue * const _density;      ///< Density variable (kg/m^3)
+  const ADVariableValue * const _heat_cap;     ///< Heat capacity variable (J/kg/K)
+  const ADVariableValue * const _conductivity; ///< Thermal conductivity variable (W/m/K)
+
+  const ADMaterialProperty<Real> * const _rho_cp_eps; ///< Material property for fv * rho * cp
+  const ADMaterialProperty<Real> * const _k_eps;      ///< Material property for fv * K (W/m/K)
+};
+
+template <class T>
+TealADThermalPropertiesInterface<T>::TealADThermalPropertiesInterface(
+    const InputParameters & parameters)
+  : T(parameters),
+    _use_rho_cp_eps(this->isParamValid("rho_cp_eps")),
+    _use_k_eps(this->isParamValid("k_eps")),
+    _volfrac(this->adCoupledValue("volume_frac")),
+    _density(adCoupledValueIfAdded(
+        "density", parameters.have_parameter<MaterialPropertyName>("rho_cp_eps"))),
+    _heat_cap(adCoupledValueIfAdded(
+        "heat_capacity", parameters.have_parameter<MaterialPropertyName>("rho_cp_eps"))),
+    _conductivity(adCoupledValueIfAdded(
+        "thermal_conductivity", parameters.have_parameter<MaterialPropertyName>("k_eps"))),
+    _rho_cp_eps(adMaterialPropertyIfValid("rho_cp_eps")),
+    _k_eps(adMaterialPropertyIfValid("k_eps"))
+{
+  TealThermalProperties::checkInputs(*this);
+}
+
+template <class T>
+const ADVariableValue *
+TealADThermalPropertiesInterface<T>::adCoupledValueIfAdded(const std::string & name,
+                                                           const bool added)
+{
+  return added ? &this->adCoupledValue(name) : nullptr;
+}
+
+template <class T>
+const ADMaterialProperty<Real> *
+TealADThermalPropertiesInterface<T>::adMaterialPropertyIfValid(const std::string & name)
+{
+  return this->isParamValid(name) ? &this->template getADMaterialProperty<Real>(name) : nullptr;
+}
+
+template <class T>
+ADReal
+TealADThermalPropertiesInterface<T>::rhoCpEpsQp() const
+{
+  const unsigned int qp = this->_qp;
+  if (_use_rho_cp_eps)
+    return (*_rho_cp_eps)[qp];
+  return (*_density)[qp] * (*_heat_cap)[qp] * _volfrac[qp];
+}
+
+template <class T>
+ADReal
+TealADThermalPropertiesInterface<T>::kEpsQp() const
+{
+  const unsigned int qp = this->_qp;
+  if (_use_k_eps)
+    return (*_k_eps)[qp];
+  return (*_conductivity)[qp] * _volfrac[qp];
+}
@@ -0,0 +1,45 @@
+/*!
+ *  \file ADThermalFluidFluxBC.h
+ *	\brief AD boundary condition kernel for the thermal fluid flux across a boundary of the domain
+ *	\details This file creates a generic boundary condition kernel for the flux of thermal fluids
+ *			at a boundary using automatic differentiation.
+ *
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was modified from the ConservativeAdvection
+ *				kernel provided by the MOOSE Framework (2023).
+ */
+
+#pragma once
+
+#include "ADIntegratedBC.h"
+#include "TealThermalPropertiesInterface.h"
+
+/// ADThermalFluidFluxBC class object inherits from ADIntegratedBC object
+/** This class object inherits from the ADIntegratedBC object.
+
+  The flux BC uses the velocity in the system to apply a boundary
+  condition based on whether or not material is leaving or entering the boundary.
+  All Jacobian contributions are computed exactly through AD. fv * rho * cp is built from
+  the coupled variables or given by the 'rho_cp_eps' AD material property. */
+class ADThermalFluidFluxBC : public TealADThermalPropertiesInterface<ADIntegratedBC>
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for BC objects in MOOSE
+  ADThermalFluidFluxBC(const InputParameters & parameters);
+
+protected:
+  /// Required function override for AD BC objects in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual ADReal computeQpResidual() override;
+
+  const ADVariableValue & _ux; ///< Velocity in the x-direction (m/s)
+  const ADVariableValue & _uy; ///< Velocity in the y-direction (m/s)
+  const ADVariableValue & _uz; ///< Velocity in the z-direction (m/s)
+
+  const ADVariableValue & _outside_temp; ///< Variable for other phase temperature (K)
+};
@@ -4,6 +4,16 @@
  *	\details This file creates a generic boundary condition kernel for the flux of thermal fluids
  *			at a boundary.
  *
+ *			The same flux applies to every upwinding type of HeatAdvectionConservative. The
+ *			SUPG stabilization acts on the strong residual inside each element and gives no
+ *			boundary term, so no separate treatment is needed at the boundary.
+ *
+ *			With 'energy_flow = true' the BC also sums the energy rates entering and
+ *			leaving each of its boundaries (W, or W/m in 2D) while it assembles the
+ *			residual, from the same quadrature point values as the flux itself. The sums
+ *			of the last residual evaluation (the converged solution at the end of a
+ *			time step) are published by the ThermalFluidEnergyFlow reporter, so no extra
+ *			pass over the boundary is needed for energy balance monitoring.
  *
  *  \author Austin Ladshaw
  *  \date 12/09/2023
@@ -14,14 +24,24 @@
 #pragma once
 
 #include "IntegratedBC.h"
+#include "DerivativeMaterialInterface.h"
+#include "TealProfilingInterface.h"
+#include "TealOffDiagonalInterface.h"
+#include "TealThermalPropertiesInterface.h"
+#include "TealSaveIn.h"
 #include "libmesh/vector_value.h"
 
+#include <map>
+
 /// ThermalFluidFluxBC class object inherits from IntegratedBC object
 /** This class object inherits from the IntegratedBC object.
 
   The flux BC uses the velocity in the system to apply a boundary
   condition based on whether or not material is leaving or entering the boundary. */
-class ThermalFluidFluxBC : public IntegratedBC
+class ThermalFluidFluxBC
+  : public TealThermalPropertiesInterface<DerivativeMaterialInterface<IntegratedBC>>,
+    public TealProfilingInterface,
+    public TealOffDiagonalInterface
 {
 public:
   /// Required new syntax for InputParameters
@@ -30,28 +50,44 @@ public:
   /// Required constructor for BC objects in MOOSE
   ThermalFluidFluxBC(const InputParameters & parameters);
 
+  /// True if the energy rates across the boundaries are summed during the residual
+  bool computesEnergyFlow() const { return _energy_flow; }
+  /// Energy rate entering across the given boundary in the last residual evaluation (W)
+  Real energyInflow(const BoundaryID bnd) const;
+  /// Energy rate leaving across the given boundary in the last residual evaluation (W)
+  Real energyOutflow(const BoundaryID bnd) const;
+
 protected:
+  /// Side residual (timed and counted when profiling)
+  virtual void computeResidual() override;
+  /// Side Jacobian (timed and counted when profiling)
+  virtual void computeJacobian() override;
+  /// Side off diagonal Jacobian (timed when profiling)
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+  /// Finds the nonlinear coupled variables (off diagonal blocks of all others are skipped)
+  virtual void initialSetup() override;
+  /// Resets the energy rate sums and starts the save_in buffers before each residual evaluation
+  virtual void residualSetup() override;
+  /// Starts the diag_save_in buffers of the Jacobian loop
+  virtual void jacobianSetup() override;
+
   /// Required function override for BC objects in MOOSE
-  /** This function returns a residual contribution for this object.*/
+  /** This function returns a residual contribution for this object. It is a generic (3D)
+    fallback, the side loops call qpResidual<dim> directly. */
   virtual Real computeQpResidual() override;
   /// Required function override for BC objects in MOOSE
   /** This function returns a Jacobian contribution for this object. The Jacobian being
     computed is the associated diagonal element in the overall Jacobian matrix for the
-    system and is used in preconditioning of the linear sub-problem. */
+    system and is used in preconditioning of the linear sub-problem. It is a generic (3D)
+    fallback, the side loops call qpJacobian<dim> directly. */
   virtual Real computeQpJacobian() override;
   /// Not Required, but aids in the preconditioning step
   /** This function returns the off diagonal Jacobian contribution for this object. By
     returning a non-zero value we will hopefully improve the convergence rate for the
-    cross coupling of the variables. */
+    cross coupling of the variables. It is a generic (3D) fallback, the side loops call
+    qpOffDiagJacobian<dim> directly. */
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
-  const VariableValue & _density;   ///< Coupled material density variable (kg/m^3)
-  const unsigned int _density_var;  ///< Variable identification for density
-  const VariableValue & _heat_cap;  ///< Coupled material heat capacity variable (J/kg/K)
-  const unsigned int _heat_cap_var; ///< Variable identification for heat capacity
-  const VariableValue & _volfrac;   ///< Variable for volume fraction (-)
-  const unsigned int _volfrac_var;  ///< Variable identification for volume fraction
-
   const VariableValue & _ux;  ///< Velocity in the x-direction (m/s)
   const unsigned int _ux_var; ///< Variable identification for ux
   const VariableValue & _uy;  ///< Velocity in the y-direction (m/s)
@@ -59,11 +95,55 @@ protected:
   const VariableValue & _uz;  ///< Velocity in the z-direction (m/s)
   const unsigned int _uz_var; ///< Variable identification for uz
 
-  /// advection vector (constructed from piece-wise components)
-  RealVectorValue _vec;
-
   const VariableValue & _outside_temp;  ///< Variable for other phase temperature (K)
   const unsigned int _outside_temp_var; ///< Variable identification for other phase temperature
 
-private:
+  /// Derivative of the material property fv * rho * cp with respect to this variable
+  const MaterialProperty<Real> * const _drho_cp_eps;
+
+  /// Returns d(fv * rho * cp)/du at the current quadrature point (zero for coupled variables)
+  Real dRhoCpEpsQp() const;
+
+  /// Spatial dimension of the mesh, which selects the side loops below once per call
+  const unsigned int _mesh_dim;
+
+  /*
+   * The side loops and quadrature point functions below are specialized for the mesh
+   * dimension, so that velocity components normal to the mesh are never read and the inner
+   * loops make no indirect calls.
+   */
+
+  /// Side residual loop, followed by the energy rate sums when requested
+  template <unsigned int dim>
+  void computeResidualDim();
+  /// Side Jacobian loop
+  template <unsigned int dim>
+  void computeJacobianDim();
+  /// Side off diagonal Jacobian loop for a coupled variable other than this one
+  template <unsigned int dim>
+  void computeOffDiagJacobianDim(unsigned int jvar);
+
+  /// Returns the velocity normal to the boundary (only the first dim components are summed)
+  template <unsigned int dim>
+  Real normalSpeedQp() const;
+  /// Returns the residual at the current quadrature point
+  template <unsigned int dim>
+  Real qpResidual() const;
+  /// Returns the Jacobian at the current quadrature point
+  template <unsigned int dim>
+  Real qpJacobian() const;
+  /// Returns the off diagonal Jacobian at the current quadrature point
+  template <unsigned int dim>
+  Real qpOffDiagJacobian(unsigned int jvar) const;
+
+  /// Adds the energy rates across the current side to the sums of its boundary
+  template <unsigned int dim>
+  void addSideEnergyFlow();
+
+  const bool _energy_flow; ///< True if the energy rates across the boundaries are summed
+  /// Inflow and outflow energy rates (W) of each boundary, for this thread's sides
+  std::map<BoundaryID, std::pair<Real, Real>> _energy_rates;
+
+  /// save_in and diag_save_in of the side loops
+  TealSaveIn _teal_save_in;
 };
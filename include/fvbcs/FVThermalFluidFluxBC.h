@@ -0,0 +1,47 @@
+/*!
+ *  \file FVThermalFluidFluxBC.h
+ *  \brief Finite volume boundary condition for the thermal fluid flux across a boundary
+ *  \details This file creates a finite volume boundary condition for the flux of
+ *            thermal fluids at a boundary:
+ *                  Res = fv * rho * cp * T_b * (vel * n)
+ *                          where T_b = T (upwind cell value) if vel * n > 0 (outflow)
+ *                          and   T_b = outside_temperature if vel * n <= 0 (inflow)
+ *
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This boundary condition was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "FVFluxBC.h"
+
+/// FVThermalFluidFluxBC class object inherits from FVFluxBC object
+/** This class object inherits from the FVFluxBC object.
+
+  The flux BC uses the velocity in the system to apply a boundary
+  condition based on whether or not material is leaving or entering the boundary. */
+class FVThermalFluidFluxBC : public FVFluxBC
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for BC objects in MOOSE
+  FVThermalFluidFluxBC(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for finite volume flux BCs in MOOSE
+  virtual ADReal computeQpResidual() override;
+
+  const Moose::Functor<ADReal> & _density;  ///< Material density functor (kg/m^3)
+  const Moose::Functor<ADReal> & _heat_cap; ///< Material heat capacity functor (J/kg/K)
+  const Moose::Functor<ADReal> & _volfrac;  ///< Volume fraction functor (-)
+
+  const Moose::Functor<ADReal> & _ux; ///< Velocity functor in the x-direction (m/s)
+  const Moose::Functor<ADReal> & _uy; ///< Velocity functor in the y-direction (m/s)
+  const Moose::Functor<ADReal> & _uz; ///< Velocity functor in the z-direction (m/s)
+
+  const Moose::Functor<ADReal> & _outside_temp; ///< Inflow temperature functor (K)
+};
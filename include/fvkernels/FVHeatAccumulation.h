@@ -0,0 +1,46 @@
+/*!
+ *  \file FVHeatAccumulation.h
+ *  \brief Finite volume kernel for the accumulation of heat
+ *  \details This file creates a finite volume kernel for the accumulation of heat
+ *            in an energy balance equation as shown below:
+ *                  Res = fv * rho * cp * dT/dt
+ *                          where fv = volume fraction (-)
+ *                          rho = material density (kg/m^3)
+ *                          cp = heat capacity of the material (J/kg/K)
+ *
+ *            The properties are functors, so they may be variables, functions,
+ *            functor material properties, or constants.
+ *
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "FVTimeKernel.h"
+
+/// FVHeatAccumulation class object inherits from FVTimeKernel object
+/** This class object inherits from the FVTimeKernel object in the MOOSE framework.
+
+    The kernel adds the following physics to each cell:
+      Res = fv * rho * cp * dT/dt
+*/
+class FVHeatAccumulation : public FVTimeKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  FVHeatAccumulation(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for finite volume time kernels in MOOSE
+  virtual ADReal computeQpResidual() override;
+
+  const Moose::Functor<ADReal> & _density;  ///< Material density functor (kg/m^3)
+  const Moose::Functor<ADReal> & _heat_cap; ///< Material heat capacity functor (J/kg/K)
+  const Moose::Functor<ADReal> & _volfrac;  ///< Volume fraction functor (-)
+};
@@ -0,0 +1,59 @@
+/*!
+ *  \file FVHeatAdvection.h
+ *  \brief Finite volume kernel for the advection of heat
+ *  \details This file creates a finite volume kernel for the conservative advection
+ *            of heat in an energy balance equation as shown below:
+ *                  Res = fv * rho * cp * T_f * (vel * n)   (on each internal face)
+ *                          where fv = volume fraction (-)
+ *                          rho = material density (kg/m^3)
+ *                          cp = heat capacity of the material (J/kg/K)
+ *                          T_f = face temperature (K)
+ *                          vel = velocity of the fluid (m/s)
+ *
+ *            The face temperature is found with the advected interpolation method
+ *            (upwind, or a TVD limiter such as vanLeer or min_mod), while the
+ *            properties and velocity are interpolated linearly.
+ *
+ *  \note This should be used with FVThermalFluidFluxBC on the open boundaries
+ *
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "FVFluxKernel.h"
+#include "MathFVUtils.h"
+
+/// FVHeatAdvection class object inherits from FVFluxKernel object
+/** This class object inherits from the FVFluxKernel object in the MOOSE framework.
+
+    The kernel adds the following physics to each face:
+      Res = fv * rho * cp * T_f * (vel * n)
+*/
+class FVHeatAdvection : public FVFluxKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  FVHeatAdvection(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for finite volume flux kernels in MOOSE
+  virtual ADReal computeQpResidual() override;
+
+  const Moose::Functor<ADReal> & _density;  ///< Material density functor (kg/m^3)
+  const Moose::Functor<ADReal> & _heat_cap; ///< Material heat capacity functor (J/kg/K)
+  const Moose::Functor<ADReal> & _volfrac;  ///< Volume fraction functor (-)
+
+  const Moose::Functor<ADReal> & _ux; ///< Velocity functor in the x-direction (m/s)
+  const Moose::Functor<ADReal> & _uy; ///< Velocity functor in the y-direction (m/s)
+  const Moose::Functor<ADReal> & _uz; ///< Velocity functor in the z-direction (m/s)
+
+  /// Method used to interpolate the advected temperature to the face
+  Moose::FV::InterpMethod _advected_interp_method;
+};
@@ -0,0 +1,48 @@
+/*!
+ *  \file FVHeatConduction.h
+ *  \brief Finite volume kernel for the conduction of heat
+ *  \details This file creates a finite volume kernel for the conduction of heat
+ *            in an energy balance equation as shown below:
+ *                  Res = - K * fv * grad_T * n   (on each internal face)
+ *                          where K = thermal conductivity (in W/m/K)
+ *                          and   fv = volume fraction (-)
+ *
+ *            The face value of K * fv is interpolated from the two neighboring
+ *            cells (harmonic mean by default).
+ *
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "FVFluxKernel.h"
+#include "MathFVUtils.h"
+
+/// FVHeatConduction class object inherits from FVFluxKernel object
+/** This class object inherits from the FVFluxKernel object in the MOOSE framework.
+
+    The kernel adds the following physics to each face:
+      Res = - K * fv * grad_T * n
+*/
+class FVHeatConduction : public FVFluxKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  FVHeatConduction(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for finite volume flux kernels in MOOSE
+  virtual ADReal computeQpResidual() override;
+
+  const Moose::Functor<ADReal> & _conductivity; ///< Thermal conductivity functor (W/m/K)
+  const Moose::Functor<ADReal> & _volfrac;      ///< Volume fraction functor (-)
+
+  /// Method used to interpolate K * fv to the face
+  const Moose::FV::InterpMethod _coeff_interp_method;
+};
@@ -0,0 +1,50 @@
+/*!
+ *  \file ThermalFrontIndicator.h
+ *  \brief Indicator for the location of a thermal front carried by advection
+ *  \details This file creates an indicator for adaptive mesh refinement that follows the
+ *            thermal fronts of HeatAdvectionConservative. Its measure is the advective
+ *            imbalance of the element that full upwinding redistributes between the
+ *            upwind and downwind nodes:
+ *                  sum_n outflux_n * T_n = - int( rho * cp * fv * v . grad(T) ) dV
+ *
+ *            The imbalance is zero where the temperature is uniform along the flow and
+ *            large across a front. It is reported as the temperature jump carried across
+ *            the element,
+ *                  dT = w * h * |int( rho * cp * fv * v . grad(T) ) dV| /
+ *                                int( rho * cp * fv * |v| ) dV
+ *                          where h = smallest edge length of the element (m)
+ *                          w = Pe / (1 + Pe), with the cell Peclet number Pe = |v| h / alpha
+ *
+ *            so that fronts already smeared by conduction (Pe << 1) are not refined.
+ *            Without a thermal conductivity the weight is 1. The value (in K) is meant for
+ *            ThermalFrontMarker.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This indicator was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "ElementIndicator.h"
+#include "TealThermalPropertiesInterface.h"
+
+/// ThermalFrontIndicator class object inherits from ElementIndicator object
+/** Advected temperature jump across each element, weighted by the cell Peclet number. */
+class ThermalFrontIndicator : public TealThermalPropertiesInterface<ElementIndicator>
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ThermalFrontIndicator(const InputParameters & parameters);
+
+protected:
+  /// Computes the indicator value of the current element
+  virtual void computeIndicator() override;
+
+  const VariableValue & _ux; ///< Velocity in the x-direction (m/s)
+  const VariableValue & _uy; ///< Velocity in the y-direction (m/s)
+  const VariableValue & _uz; ///< Velocity in the z-direction (m/s)
+};
@@ -0,0 +1,44 @@
+/*!
+ *  \file ADHeatAccumulation.h
+ *	\brief AD kernel to create a heat accumulation kernel for thermal dynamics
+ *	\details This file creates a heat accumulation kernel for thermal dynamics
+ *				using automatic differentiation and introduces the following phyiscs:
+ *						Res = test * fv * rho * cp * dTdt
+ *								where fv = volume fraction (-)
+ *									  rho = material density (kg/m^3)
+ *									  cp = heat capacity of the material (J/kg/K)
+ *									  dTdt = internal heat rate change (K/s)
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "ADTimeKernel.h"
+#include "TealThermalPropertiesInterface.h"
+
+/// ADHeatAccumulation class object inherits from ADTimeKernel object
+/** This class object inherits from the ADTimeKernel object in the MOOSE framework.
+    All Jacobian contributions (including the cross coupling to the density,
+    heat capacity, and volume fraction, or to the variables of the 'rho_cp_eps' AD
+    material property) are computed exactly through AD.
+
+    The kernel adds the following physics:
+      Res = test * fv * rho * cp * dTdt
+*/
+class ADHeatAccumulation : public TealADThermalPropertiesInterface<ADTimeKernel>
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ADHeatAccumulation(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for AD kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual ADReal computeQpResidual() override;
+};
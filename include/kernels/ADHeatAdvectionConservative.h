@@ -0,0 +1,76 @@
+/*!
+ *  \file ADHeatAdvectionConservative.h
+ *	\brief AD kernel to create heat advection physics with upwinding schemes
+ *	\details This file creates a heat advection kernel with optional upwinding
+ *				using automatic differentiation and introduces the following phyiscs:
+ *						Res = -grad_test * fv * vel * rho * cp * T
+ *								where fv = volume fraction (-)
+ *									  rho = material density (kg/m^3)
+ *									  cp = heat capacity of the material (J/kg/K)
+ *									  T = temperature of the fluid (K)
+ *									  vel = velocity of the fluid (m/s)
+ *
+ * 	\note This REQUIRES use with ADThermalFluidFluxBC due to Gauss Divergence
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was modified from the ConservativeAdvection
+ *				kernel provided by the MOOSE Framework (2023).
+ */
+
+#pragma once
+
+#include "ADKernel.h"
+#include "TealThermalPropertiesInterface.h"
+
+/**
+ * Advection of the variable by the velocity provided by the user.
+ * Options for numerical stabilization are: none; full upwinding.
+ * All Jacobian contributions (including the full upwinding) are computed exactly through AD.
+ * fv * rho * cp is built from the coupled variables or given by the 'rho_cp_eps' AD material
+ * property.
+ */
+class ADHeatAdvectionConservative : public TealADThermalPropertiesInterface<ADKernel>
+{
+public:
+  static InputParameters validParams();
+
+  ADHeatAdvectionConservative(const InputParameters & parameters);
+
+protected:
+  virtual ADReal computeQpResidual() override;
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+  virtual void computeResidualAndJacobian() override;
+
+  const ADVariableValue & _ux; ///< Velocity in the x-direction (m/s)
+  const ADVariableValue & _uy; ///< Velocity in the y-direction (m/s)
+  const ADVariableValue & _uz; ///< Velocity in the z-direction (m/s)
+
+  /// enum to make the code clearer
+  enum class JacRes
+  {
+    CALCULATE_RESIDUAL = 0,
+    CALCULATE_JACOBIAN = 1,
+    CALCULATE_RESIDUAL_AND_JACOBIAN = 2
+  };
+
+  /// Type of upwinding
+  const enum class UpwindingType { none, full } _upwinding;
+
+  /// Nodal value of u, used for full upwinding
+  const MooseArray<ADReal> & _u_nodal;
+
+  /// In the full-upwind scheme, whether a node is an upwind node
+  std::vector<bool> _upwind_node;
+
+  /// In the full-upwind scheme, the local (AD) residual at each node
+  std::vector<ADReal> _upwind_residuals;
+
+  /// Returns - _grad_test * velocity
+  ADReal negSpeedQp() const;
+
+  /// Calculates the fully-upwind Residual and/or Jacobian (depending on res_or_jac)
+  void fullUpwind(JacRes res_or_jac);
+};
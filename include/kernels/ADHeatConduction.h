@@ -0,0 +1,42 @@
+/*!
+ *  \file ADHeatConduction.h
+ *  \brief AD kernel for creating a heat conduction
+ *  \details This file creates a kernel for the conduction of heat
+ *            in an energy balance equation using automatic differentiation:
+ *                  Res = grad_test * grad_u * K * fv
+ *                          where K = thermal conductivity (in W/m/K)
+ *							and   fv = volume fraction (-)
+ *
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "ADKernel.h"
+#include "TealThermalPropertiesInterface.h"
+
+/// ADHeatConduction class object inherits from ADKernel object
+/** This class object inherits from the ADKernel object in the MOOSE framework.
+    All Jacobian contributions are computed exactly through AD. fv * K is built from the
+    coupled variables or given by the 'k_eps' AD material property.
+
+    The kernel adds the following physics:
+      Res = grad_test * grad_u * K * fv
+*/
+class ADHeatConduction : public TealADThermalPropertiesInterface<ADKernel>
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ADHeatConduction(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for AD kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual ADReal computeQpResidual() override;
+};
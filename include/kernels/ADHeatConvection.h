@@ -0,0 +1,49 @@
+/*!
+ *  \file ADHeatConvection.h
+ *  \brief AD kernel for creating an exchange of thermal energy between two phases
+ *  \details This file creates a kernel for the coupling a pair of heat variables in
+ *            the same domain as a form of convective transfer using automatic differentiation:
+ *                  Res = test * h * A * fv * (T - T_other)
+ *                          where T = temperature of this heat variable's phase (K)
+ *                          and T_other = temperature of the other heat variable's phase (K)
+ *                          h = heat transfer coefficient (W/m^2/K)
+ *                          A = specific contact area per volume between the phases (m^-1)
+ *                              = area of solids per volume of solids
+ *                          fv = volume fraction of the phases (volume solids / total volume)
+ *
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "ADKernel.h"
+
+/// ADHeatConvection class object inherits from ADKernel object
+/** This class object inherits from the ADKernel object in the MOOSE framework.
+    All Jacobian contributions are computed exactly through AD.
+
+    The kernel adds the following physics:
+      Res = test * h * A * fv * (T - T_other)
+*/
+class ADHeatConvection : public ADKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ADHeatConvection(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for AD kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual ADReal computeQpResidual() override;
+
+  const ADVariableValue & _hs;         ///< Variable for Heat transfer coefficient (W/m^2/K)
+  const ADVariableValue & _other_temp; ///< Variable for other phase temperature (K)
+  const ADVariableValue & _volfrac;    ///< Variable for volume fraction (-)
+  const ADVariableValue & _specarea;   ///< Variable for specific area (m^-1)
+};
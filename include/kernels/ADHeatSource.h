@@ -0,0 +1,40 @@
+/*!
+ *  \file ADHeatSource.h
+ *  \brief AD kernel for creating a heat source or sink by volume
+ *  \details This file creates a kernel for the coupling a heat source or sink
+ *            into an energy balance equation using automatic differentiation:
+ *                  Res = test * v
+ *                          where v = coupled heat source (in W/m^3)
+ *
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "ADKernel.h"
+
+/// ADHeatSource class object inherits from ADKernel object
+/** This class object inherits from the ADKernel object in the MOOSE framework.
+
+    The kernel adds the following physics:
+      Res = test * v
+*/
+class ADHeatSource : public ADKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ADHeatSource(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for AD kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual ADReal computeQpResidual() override;
+
+  const ADVariableValue & _coupled_source; ///< Coupled variable (W/m^3)
+};
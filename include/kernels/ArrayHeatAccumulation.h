@@ -0,0 +1,65 @@
+/*!
+ *  \file ArrayHeatAccumulation.h
+ *	\brief Array kernel to create a heat accumulation kernel for several phases at once
+ *	\details This file creates a heat accumulation kernel for an array variable whose
+ *				components are the temperatures of several phases (or species) and
+ *				introduces the following phyiscs for each component c:
+ *						Res_c = test * fv_c * rho_c * cp_c * dT_c/dt
+ *								where fv_c = volume fraction of phase c (-)
+ *									  rho_c = density of phase c (kg/m^3)
+ *									  cp_c = heat capacity of phase c (J/kg/K)
+ *									  dT_c/dt = internal heat rate change of phase c (K/s)
+ *
+ *			All components are assembled in the same element loop, so N phases need one
+ *			object instead of N HeatAccumulation kernels. The properties are lists with
+ *			one value, or one value per component, or the array material property
+ *			'rho_cp_eps' for properties that vary in space.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "ArrayTimeKernel.h"
+#include "TealProfilingInterface.h"
+
+/// ArrayHeatAccumulation class object inherits from ArrayTimeKernel object
+/** This class object inherits from the ArrayTimeKernel object in the MOOSE framework.
+
+    The kernel adds the following physics to each component c:
+      Res_c = test * fv_c * rho_c * cp_c * dT_c/dt
+*/
+class ArrayHeatAccumulation : public ArrayTimeKernel, public TealProfilingInterface
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ArrayHeatAccumulation(const InputParameters & parameters);
+
+protected:
+  /// Element residual (timed and counted when profiling)
+  virtual void computeResidual() override;
+  /// Element Jacobian (timed and counted when profiling)
+  virtual void computeJacobian() override;
+
+  /// Required residual function for array kernels in MOOSE
+  /** This function fills the residual contributions of all components for this object.*/
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+
+  /// Diagonal Jacobian of all components (the components are not coupled by accumulation)
+  virtual RealEigenVector computeQpJacobian() override;
+
+  const bool _use_rho_cp_eps; ///< True if fv * rho * cp is given by a material property
+  /// Array material property for fv * rho * cp of each component (J/K/m^3)
+  const MaterialProperty<RealEigenVector> * const _rho_cp_eps;
+  /// Constant fv * rho * cp of each component, from the list parameters (J/K/m^3)
+  RealEigenVector _rho_cp_eps_const;
+
+  /// Returns fv * rho * cp of all components at the current quadrature point
+  const RealEigenVector & rhoCpEpsQp() const;
+
+};
@@ -0,0 +1,61 @@
+/*!
+ *  \file ArrayHeatConduction.h
+ *  \brief Array kernel for creating a heat conduction for several phases at once
+ *  \details This file creates a kernel for the conduction of heat of each component of
+ *            an array variable of phase (or species) temperatures as shown below:
+ *                  Res_c = grad_test * grad_u_c * K_c * fv_c
+ *                          where K_c = thermal conductivity of phase c (in W/m/K)
+ *							and   fv_c = volume fraction of phase c (-)
+ *
+ *            All components are assembled in the same element loop. The properties are
+ *            lists with one value, or one value per component, or the array material
+ *            property 'k_eps' for properties that vary in space.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "ArrayKernel.h"
+#include "TealProfilingInterface.h"
+
+/// ArrayHeatConduction class object inherits from ArrayKernel object
+/** This class object inherits from the ArrayKernel object in the MOOSE framework.
+
+    The kernel adds the following physics to each component c:
+      Res_c = grad_test * grad_u_c * K_c * fv_c
+*/
+class ArrayHeatConduction : public ArrayKernel, public TealProfilingInterface
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ArrayHeatConduction(const InputParameters & parameters);
+
+protected:
+  /// Element residual (timed and counted when profiling)
+  virtual void computeResidual() override;
+  /// Element Jacobian (timed and counted when profiling)
+  virtual void computeJacobian() override;
+
+  /// Required residual function for array kernels in MOOSE
+  /** This function fills the residual contributions of all components for this object.*/
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+
+  /// Diagonal Jacobian of all components (the components are not coupled by conduction)
+  virtual RealEigenVector computeQpJacobian() override;
+
+  const bool _use_k_eps; ///< True if fv * K is given by a material property
+  /// Array material property for fv * K of each component (W/m/K)
+  const MaterialProperty<RealEigenVector> * const _k_eps;
+  /// Constant fv * K of each component, from the list parameters (W/m/K)
+  RealEigenVector _k_eps_const;
+
+  /// Returns fv * K of all components at the current quadrature point
+  const RealEigenVector & kEpsQp() const;
+
+};
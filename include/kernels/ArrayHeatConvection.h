@@ -0,0 +1,79 @@
+/*!
+ *  \file ArrayHeatConvection.h
+ *  \brief Array kernel for the exchange of thermal energy between several phases at once
+ *  \details This file creates a kernel for the convective exchange of heat between one
+ *            component of an array variable of phase temperatures (the fluid) and each
+ *            of its other components (the solid phases):
+ *                  Res_s = test * h_s * A_s * fv_s * (T_s - T_f)
+ *                  Res_f = test * sum_s h_s * A_s * fv_s * (T_f - T_s)
+ *                          where T_f = temperature of the fluid component (K)
+ *                          and T_s = temperature of solid component s (K)
+ *                          h_s = heat transfer coefficient of phase s (W/m^2/K)
+ *                          A_s = specific contact area of phase s (m^-1)
+ *                              = area of solids per volume of solids
+ *                          fv_s = volume fraction of phase s (volume solids / total volume)
+ *
+ *            The coefficients are gathered at construction in a constant (N x N) exchange
+ *            matrix E, so that Res = test * E * T. E * T is formed once per quadrature point
+ *            for all test functions, and the full Jacobian of the exchange is
+ *            test * phi * E. The cross component blocks are only assembled with the full
+ *            Jacobian (e.g. SMP with full = true).
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "ArrayKernel.h"
+#include "TealProfilingInterface.h"
+
+/// ArrayHeatConvection class object inherits from ArrayKernel object
+/** This class object inherits from the ArrayKernel object in the MOOSE framework.
+
+    The kernel adds the following physics to all components:
+      Res = test * E * T,  with E the constant interphase exchange matrix
+*/
+class ArrayHeatConvection : public ArrayKernel, public TealProfilingInterface
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ArrayHeatConvection(const InputParameters & parameters);
+
+protected:
+  /// Element residual (timed and counted when profiling)
+  virtual void computeResidual() override;
+  /// Element Jacobian (timed and counted when profiling)
+  virtual void computeJacobian() override;
+  /// Element off diagonal Jacobian (timed when profiling)
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
+  /// Forms E * T at the current quadrature point, shared by all test functions
+  virtual void initQpResidual() override;
+
+  /// Required residual function for array kernels in MOOSE
+  /** This function fills the residual contributions of all components for this object.*/
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+
+  /// Diagonal of the exchange Jacobian
+  virtual RealEigenVector computeQpJacobian() override;
+
+  /// Full exchange Jacobian between the components (when jvar is this variable)
+  virtual RealEigenMatrix computeQpOffDiagJacobian(const MooseVariableFEBase & jvar) override;
+
+  const unsigned int _fluid_component; ///< Component of the array variable for the fluid
+
+  /// Treatment of the interphase exchange in the Jacobian
+  /** 'full' adds the blocks between the fluid and the solid components, 'diagonal' drops
+    them (the residual is unchanged). */
+  const enum class ExchangeJacobian { full, diagonal } _exchange_jacobian;
+
+  RealEigenMatrix _exchange_matrix;   ///< Interphase exchange matrix E (W/K/m^3)
+  RealEigenVector _exchange_diagonal; ///< Diagonal of E (W/K/m^3)
+  RealEigenVector _qp_exchange;       ///< E * T at the current quadrature point (W/m^3)
+
+};
@@ -0,0 +1,112 @@
+/*!
+ *  \file ChannelHeatTransport.h
+ *	\brief Reduced order kernel for heat transport along 1D flow channels
+ *	\details This file creates a fast path kernel for channels meshed with EDGE2 elements
+ *				that combines accumulation, conduction, fully upwinded advection, and
+ *				exchange with the channel wall:
+ *						Res = test * fv * rho * cp * dTdt
+ *							+ grad_test * grad_u * K * fv
+ *							- grad_test * fv * vel * rho * cp * T_upwind
+ *							+ test * h * A * fv * (T - T_wall)
+ *								where fv = volume fraction (-)
+ *									  rho = material density (kg/m^3)
+ *									  cp = heat capacity of the material (J/kg/K)
+ *									  K = thermal conductivity (W/m/K)
+ *									  vel = velocity along the channel (m/s)
+ *									  h = wall heat transfer coefficient (W/m^2/K)
+ *									  A = wall area per channel volume (m^-1)
+ *									  T_wall = wall temperature (K)
+ *
+ *			The coefficients are averaged over each element and the 2x2 element residual and
+ *			Jacobian are written in closed form: the mass and wall exchange are lumped onto
+ *			the nodes, conduction is the two point difference, and the advective flux is
+ *			carried by the upwind node. Each element therefore only couples its own two
+ *			nodes, so a channel forms a tridiagonal block of the system matrix (see
+ *			ChannelBundleMeshGenerator).
+ *
+ *			The velocity is taken along the element from its first to its second node
+ *			(the positive x-direction for ChannelBundleMeshGenerator).
+ *
+ * 	\note This REQUIRES use with ThermalFluidFluxBC due to Gauss Divergence
+ *
+ * 	\note Since all terms are tagged as time terms, this kernel is only correct for the
+ *			implicit-euler and bdf2 time integration schemes, and reports an error for others.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "TimeKernel.h"
+#include "TealProfilingInterface.h"
+#include "TealOffDiagonalInterface.h"
+#include "TealThermalPropertiesInterface.h"
+#include "TealSaveIn.h"
+
+/// ChannelHeatTransport class object inherits from TimeKernel object
+/** This class object inherits from the TimeKernel object in the MOOSE framework.
+
+    The kernel adds the following physics on EDGE2 elements:
+      Res = test * fv * rho * cp * dTdt + grad_test * grad_u * K * fv
+            - grad_test * fv * vel * rho * cp * T_upwind + test * h * A * fv * (T - T_wall)
+*/
+class ChannelHeatTransport : public TealThermalPropertiesInterface<TimeKernel>,
+                             public TealProfilingInterface,
+                             public TealOffDiagonalInterface
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ChannelHeatTransport(const InputParameters & parameters);
+
+protected:
+  /// Closed form element residual
+  virtual void computeResidual() override;
+  /// Closed form element Jacobian
+  virtual void computeJacobian() override;
+  /// Closed form off diagonal Jacobian for the velocity and wall temperature
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+  /// Checks the time scheme and finds the nonlinear coupled variables (for off diagonal blocks)
+  virtual void initialSetup() override;
+  /// Starts the save_in buffers of the residual loop
+  virtual void residualSetup() override;
+  /// Starts the diag_save_in buffers of the Jacobian loop
+  virtual void jacobianSetup() override;
+
+  /// Not used by the closed form element loops
+  virtual Real computeQpResidual() override { return 0.0; }
+  /// Not used by the closed form element loops
+  virtual Real computeQpJacobian() override { return 0.0; }
+
+  const VariableValue & _vel;  ///< Velocity along the channel (m/s)
+  const unsigned int _vel_var; ///< Variable identification for the velocity
+  /// Shape functions of the velocity variable, only valid if the velocity is a variable
+  const VariablePhiValue * const _vel_phi;
+  const VariableValue & _htc;        ///< Wall heat transfer coefficient (W/m^2/K)
+  const VariableValue & _area;       ///< Wall area per channel volume (m^-1)
+  const VariableValue & _wall_temp;  ///< Nodal wall temperature (K)
+  const unsigned int _wall_temp_var; ///< Variable identification for the wall temperature
+
+  const VariableValue & _u_nodal;     ///< Nodal values of the temperature (K)
+  const VariableValue & _u_dot_nodal; ///< Nodal time derivative of the temperature (K/s)
+
+  Real _length;         ///< Length of the current element (m)
+  Real _mass;           ///< Lumped nodal mass fv * rho * cp * L / 2 (J/m^2/K)
+  Real _cond;           ///< Conductance fv * K / L (W/m^2/K)
+  Real _flux;           ///< Advective flux coefficient fv * rho * cp * vel (W/m^2/K)
+  Real _exchange;       ///< Lumped nodal wall exchange h * A * fv * L / 2 (W/m^2/K)
+  Real _rho_cp_eps_avg; ///< Element average of fv * rho * cp (J/m^3/K)
+
+  /// Forms the element averaged coefficients for the current element
+  void computeElementCoefficients();
+
+  /// Index (0 or 1) of the upwind node of the current element
+  unsigned int upwindNode() const { return _flux >= 0.0 ? 0 : 1; }
+
+  /// save_in and diag_save_in of the closed form element loops
+  TealSaveIn _teal_save_in;
+};
@@ -9,6 +9,12 @@
  *									  cp = heat capacity of the material (J/kg/K)
  *									  dTdt = internal heat rate change (K/s)
  *
+ *			With 'lumped_mass = true' the mass matrix is row-sum lumped, i.e., the
+ *			nodal dTdt of each test function's own node is used in place of the
+ *			interpolated value. The Jacobian is then diagonal, so explicit time
+ *			integrators (ActuallyExplicitEuler, ExplicitSSPRungeKutta) only need a
+ *			diagonal inverse per step.
+ *
  *  \author Austin Ladshaw
  *  \date 12/09/2023
  *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
@@ -17,6 +23,10 @@
 #pragma once
 
 #include "CoefTimeDerivative.h"
+#include "DerivativeMaterialInterface.h"
+#include "TealProfilingInterface.h"
+#include "TealOffDiagonalInterface.h"
+#include "TealThermalPropertiesInterface.h"
 
 /// HeatAccumulation class object inherits from CoefTimeDerivative object
 /** This class object inherits from the CoefTimeDerivative object in the MOOSE framework.
@@ -24,7 +34,10 @@
     The kernel adds the following physics:
       Res = test * fv * rho * cp * dTdt
 */
-class HeatAccumulation : public CoefTimeDerivative
+class HeatAccumulation
+  : public TealThermalPropertiesInterface<DerivativeMaterialInterface<CoefTimeDerivative>>,
+    public TealProfilingInterface,
+    public TealOffDiagonalInterface
 {
 public:
   /// Required new syntax for InputParameters
@@ -34,6 +47,20 @@ public:
   HeatAccumulation(const InputParameters & parameters);
 
 protected:
+  /// Element residual (timed and counted when profiling)
+  virtual void computeResidual() override;
+  /// Element Jacobian (timed and counted when profiling)
+  virtual void computeJacobian() override;
+  /// Element off diagonal Jacobian (timed when profiling)
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+  /// Finds the nonlinear coupled variables (off diagonal blocks of all others are skipped)
+  virtual void initialSetup() override;
+
+  /// Fills the per quadrature point arrays before the residual loop
+  virtual void precalculateResidual() override;
+  /// Fills the per quadrature point arrays before the Jacobian loop
+  virtual void precalculateJacobian() override;
+
   /// Required residual function for standard kernels in MOOSE
   /** This function returns a residual contribution for this object.*/
   virtual Real computeQpResidual() override;
@@ -48,10 +75,16 @@ protected:
     cross coupling of the variables. */
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
-  const VariableValue & _density;   ///< Coupled material density variable (kg/m^3)
-  const unsigned int _density_var;  ///< Variable identification for density
-  const VariableValue & _heat_cap;  ///< Coupled material heat capacity variable (J/kg/K)
-  const unsigned int _heat_cap_var; ///< Variable identification for heat capacity
-  const VariableValue & _volfrac;   ///< Variable for volume fraction (-)
-  const unsigned int _volfrac_var;  ///< Variable identification for volume fractio
+  /// Derivative of the material property fv * rho * cp with respect to this variable
+  const MaterialProperty<Real> * const _drho_cp_eps;
+
+  const bool _lumped_mass; ///< True if the mass matrix is lumped onto the diagonal
+  /// Nodal time derivative of the variable (only used with a lumped mass matrix)
+  const VariableValue * const _u_dot_nodal;
+
+  std::vector<Real> _qp_rho_cp_eps;  ///< fv * rho * cp at each quadrature point of the element
+  std::vector<Real> _qp_drho_cp_eps; ///< d(fv * rho * cp)/du at each quadrature point
+
+  /// Fills the per quadrature point arrays for the current element
+  void precomputeQpData();
 };
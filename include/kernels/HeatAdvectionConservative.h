@@ -10,6 +10,12 @@
  *									  T = temperature of the fluid (K)
  *									  vel = velocity of the fluid (m/s)
  *
+ *			With SUPG stabilization the following is added inside each element:
+ *						Res += tau * (vel * grad_test) * fv * rho * cp * (dTdt + vel * grad_T)
+ *								where tau = 1 / sqrt( (2/dt)^2 + (2|vel|/h)^2 + 9(4 a/h^2)^2 )
+ *									  h = element length along the streamline (m)
+ *									  a = optional thermal diffusivity fv*K / (fv*rho*cp) (m^2/s)
+ *
  * 	\note This REQUIRES use with ThermalFluidFluxBC due to Gauss Divergence
  *
  *  \author Austin Ladshaw
@@ -21,12 +27,22 @@
 #pragma once
 
 #include "Kernel.h"
+#include "DerivativeMaterialInterface.h"
+#include "TealProfilingInterface.h"
+#include "TealOffDiagonalInterface.h"
+#include "TealThermalPropertiesInterface.h"
+#include "TealSaveIn.h"
+
+#include <unordered_map>
 
 /**
  * Advection of the variable by the velocity provided by the user.
- * Options for numerical stabilization are: none; full upwinding
+ * Options for numerical stabilization are: none; full upwinding; SUPG
  */
-class HeatAdvectionConservative : public Kernel
+class HeatAdvectionConservative
+  : public TealThermalPropertiesInterface<DerivativeMaterialInterface<Kernel>>,
+    public TealProfilingInterface,
+    public TealOffDiagonalInterface
 {
 public:
   static InputParameters validParams();
@@ -34,21 +50,31 @@ public:
   HeatAdvectionConservative(const InputParameters & parameters);
 
 protected:
+  /// Generic (3D) fallback, the element loops call qpResidual<dim> directly
   virtual Real computeQpResidual() override;
+  /// Generic (3D) fallback, the element loops call qpJacobian<dim> directly
   virtual Real computeQpJacobian() override;
   virtual void computeResidual() override;
   virtual void computeJacobian() override;
-
-  /// Adding the off-diagonal components for better convergence
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+  /// Finds the nonlinear coupled variables (off diagonal blocks of all others are skipped)
+  virtual void initialSetup() override;
+
+  /// Errors if the cached outflux would go stale during the solve with the rho_cp_eps material
+  void checkCachedMaterial() const;
+
+  /// Clears the upwind topology cache at the start of every time step
+  virtual void timestepSetup() override;
+  /// Clears the upwind topology cache when the mesh changes
+  virtual void meshChanged() override;
+  /// Starts the save_in buffers of the residual loop
+  virtual void residualSetup() override;
+  /// Starts the diag_save_in buffers of the Jacobian loop
+  virtual void jacobianSetup() override;
+
+  /// Adding the off-diagonal components for better convergence (generic 3D fallback)
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
-  const VariableValue & _density;   ///< Coupled material density variable (kg/m^3)
-  const unsigned int _density_var;  ///< Variable identification for density
-  const VariableValue & _heat_cap;  ///< Coupled material heat capacity variable (J/kg/K)
-  const unsigned int _heat_cap_var; ///< Variable identification for heat capacity
-  const VariableValue & _volfrac;   ///< Variable for volume fraction (-)
-  const unsigned int _volfrac_var;  ///< Variable identification for volume fraction
-
   const VariableValue & _ux;  ///< Velocity in the x-direction (m/s)
   const unsigned int _ux_var; ///< Variable identification for ux
   const VariableValue & _uy;  ///< Velocity in the y-direction (m/s)
@@ -56,8 +82,8 @@ protected:
   const VariableValue & _uz;  ///< Velocity in the z-direction (m/s)
   const unsigned int _uz_var; ///< Variable identification for uz
 
-  /// advection vector (constructed from piece-wise components)
-  RealVectorValue _vec;
+  /// Derivative of the material property fv * rho * cp with respect to this variable
+  const MaterialProperty<Real> * const _drho_cp_eps;
 
   /// enum to make the code clearer
   enum class JacRes
@@ -67,7 +93,17 @@ protected:
   };
 
   /// Type of upwinding
-  const enum class UpwindingType { none, full } _upwinding;
+  const enum class UpwindingType { none, full, supg } _upwinding;
+
+  /// Time derivative of u (only for SUPG in transient simulations, otherwise nullptr)
+  const VariableValue * const _u_dot;
+  /// Derivative of the time derivative of u (only for SUPG in transient simulations)
+  const VariableValue * const _du_dot_du;
+
+  /// True if the SUPG parameter includes the diffusive limit
+  const bool _use_supg_k_eps;
+  /// Material property fv * K used by the diffusive limit of the SUPG parameter
+  const MaterialProperty<Real> * const _supg_k_eps;
 
   /// Nodal value of u, used for full upwinding
   const VariableValue & _u_nodal;
@@ -78,9 +114,96 @@ protected:
   /// In the full-upwind scheme d(total_mass_out)/d(variable_at_node_i)
   std::vector<Real> _dtotal_mass_out;
 
-  /// Returns - _grad_test * velocity
-  Real negSpeedQp();
+  /// In the full-upwind scheme d(total_in)/d(variable_at_node_i), from the property derivative
+  std::vector<Real> _dtotal_in;
+
+  /// In the full-upwind scheme d(outflux_i)/d(variable_at_node_j), from the property derivative
+  DenseMatrix<Number> _doutflux;
+
+  /// True if the upwind topology of each element is reused within a time step
+  const bool _cache_upwind_topology;
+
+  /// Upwind topology of a single element for the full-upwind scheme
+  struct UpwindTopology
+  {
+    std::vector<Real> outflux;     ///< Outflux from each node of the element
+    std::vector<bool> upwind_node; ///< Whether each node of the element is an upwind node
+  };
+
+  /// Cached upwind topology of each element (keyed by element id)
+  std::unordered_map<dof_id_type, UpwindTopology> _upwind_cache;
+
+  /// Computes the outflux from each node into _local_re and sets _upwind_node
+  template <unsigned int dim>
+  void computeNodalOutflux();
+
+  /// Computes the derivative of the outflux from each node through d(fv * rho * cp)/du
+  template <unsigned int dim>
+  void computeNodalOutfluxDerivative();
+
+  std::vector<Real> _qp_jxw;            ///< JxW * coord at each quadrature point of the element
+  std::vector<Real> _qp_rho_cp_eps;     ///< fv * rho * cp at each quadrature point of the element
+  std::vector<Real> _qp_drho_cp_eps;    ///< d(fv * rho * cp)/du at each quadrature point
+  std::vector<RealVectorValue> _qp_vel; ///< Velocity at each quadrature point of the element
+  std::vector<Real> _qp_tau;            ///< SUPG parameter at each quadrature point
+  std::vector<Real> _qp_strong_res;     ///< SUPG strong residual at each quadrature point
+
+  /// Spatial dimension of the mesh, which selects the element loops below once per call
+  const unsigned int _mesh_dim;
+
+  /*
+   * The element loops and quadrature point functions below are specialized for the mesh
+   * dimension, so that velocity components normal to the mesh are never read and the inner
+   * loops make no indirect calls.
+   */
+
+  /// Element residual loop (none and SUPG), or fullUpwind
+  template <unsigned int dim>
+  void computeResidualDim();
+  /// Element Jacobian loop (none and SUPG), or fullUpwind
+  template <unsigned int dim>
+  void computeJacobianDim();
+  /// Element off diagonal Jacobian loop for a coupled variable other than this one
+  template <unsigned int dim>
+  void computeOffDiagJacobianDim(unsigned int jvar);
 
   /// Calculates the fully-upwind Residual and Jacobian (depending on res_or_jac)
+  template <unsigned int dim>
   void fullUpwind(JacRes res_or_jac);
+
+  /// Fills the per quadrature point arrays (only the first dim velocities are read)
+  template <unsigned int dim>
+  void precomputeQpData();
+
+  /// Fills the SUPG parameter and strong residual arrays (after precomputeQpData)
+  void precomputeSupgData();
+
+  /// Returns the residual at the current quadrature point (none and SUPG)
+  template <unsigned int dim>
+  Real qpResidual() const;
+  /// Returns the Jacobian at the current quadrature point (none and SUPG)
+  template <unsigned int dim>
+  Real qpJacobian() const;
+  /// Returns the off diagonal Jacobian at the current quadrature point
+  template <unsigned int dim>
+  Real qpOffDiagJacobian(unsigned int jvar) const;
+
+  /// Returns the SUPG residual contribution (uses the per quadrature point arrays)
+  template <unsigned int dim>
+  Real supgResidualQp() const;
+  /// Returns the SUPG Jacobian contribution, holding tau and the properties fixed
+  template <unsigned int dim>
+  Real supgJacobianQp() const;
+
+  /// Returns - _grad_test * velocity * fv * rho * cp (uses the per quadrature point arrays)
+  template <unsigned int dim>
+  Real negSpeedQp() const;
+  /// Returns _grad_test * velocity (only the first dim components are summed)
+  template <unsigned int dim>
+  Real gradTestDotVelQp() const;
+
+  const PerfID _full_upwind_timer; ///< PerfGraph section for fullUpwind
+
+  /// save_in and diag_save_in of the element loops
+  TealSaveIn _teal_save_in;
 };
@@ -16,6 +16,10 @@
 #pragma once
 
 #include "Kernel.h"
+#include "DerivativeMaterialInterface.h"
+#include "TealProfilingInterface.h"
+#include "TealOffDiagonalInterface.h"
+#include "TealThermalPropertiesInterface.h"
 
 /// HeatConduction class object inherits from Kernel object
 /** This class object inherits from the Kernel object in the MOOSE framework.
@@ -23,7 +27,10 @@
     The kernel adds the following physics:
       Res = grad_test * grad_u * K * fv
 */
-class HeatConduction : public Kernel
+class HeatConduction
+  : public TealThermalPropertiesInterface<DerivativeMaterialInterface<Kernel>>,
+    public TealProfilingInterface,
+    public TealOffDiagonalInterface
 {
 public:
   /// Required new syntax for InputParameters
@@ -33,6 +40,22 @@ public:
   HeatConduction(const InputParameters & parameters);
 
 protected:
+  /// Element residual (timed and counted when profiling)
+  virtual void computeResidual() override;
+  /// Element Jacobian (timed and counted when profiling)
+  virtual void computeJacobian() override;
+  /// Element off diagonal Jacobian (timed when profiling)
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+  /// Finds the nonlinear coupled variables (off diagonal blocks of all others are skipped)
+  virtual void initialSetup() override;
+
+  /// Fills the per quadrature point arrays before the residual loop
+  virtual void precalculateResidual() override;
+  /// Fills the per quadrature point arrays before the Jacobian loop
+  virtual void precalculateJacobian() override;
+  /// Fills the per quadrature point arrays before the off diagonal Jacobian loop
+  virtual void precalculateOffDiagJacobian(unsigned int jvar) override;
+
   /// Required residual function for standard kernels in MOOSE
   /** This function returns a residual contribution for this object.*/
   virtual Real computeQpResidual();
@@ -49,10 +72,12 @@ protected:
    cross coupling of the variables. */
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
-  const VariableValue & _conductivity;  ///< Thermal Conductivity variable (W/m/K)
-  const unsigned int _conductivity_var; ///< Variable identification for the thermal conductivity
-  const VariableValue & _volfrac;       ///< Variable for volume fraction (-)
-  const unsigned int _volfrac_var;      ///< Variable identification for volume fractio
+  /// Derivative of the material property fv * K with respect to this variable
+  const MaterialProperty<Real> * const _dk_eps;
+
+  std::vector<Real> _qp_k_eps;  ///< fv * K at each quadrature point of the element
+  std::vector<Real> _qp_dk_eps; ///< d(fv * K)/du at each quadrature point (zero without material)
 
-private:
+  /// Fills the per quadrature point arrays for the current element
+  void precomputeQpData();
 };
@@ -20,6 +20,8 @@
 #pragma once
 
 #include "Kernel.h"
+#include "TealProfilingInterface.h"
+#include "TealOffDiagonalInterface.h"
 
 /// HeatConvection class object inherits from Kernel object
 /** This class object inherits from the Kernel object in the MOOSE framework.
@@ -27,7 +29,9 @@
     The kernel adds the following physics:
       Res = test * h * A * fv * (T - T_other)
 */
-class HeatConvection : public Kernel
+class HeatConvection : public Kernel,
+                       public TealProfilingInterface,
+                       public TealOffDiagonalInterface
 {
 public:
   /// Required new syntax for InputParameters
@@ -37,6 +41,22 @@ public:
   HeatConvection(const InputParameters & parameters);
 
 protected:
+  /// Element residual (timed and counted when profiling)
+  virtual void computeResidual() override;
+  /// Element Jacobian (timed and counted when profiling)
+  virtual void computeJacobian() override;
+  /// Element off diagonal Jacobian (timed when profiling)
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+  /// Finds the nonlinear coupled variables (off diagonal blocks of all others are skipped)
+  virtual void initialSetup() override;
+
+  /// Fills the per quadrature point arrays before the residual loop
+  virtual void precalculateResidual() override;
+  /// Fills the per quadrature point arrays before the Jacobian loop
+  virtual void precalculateJacobian() override;
+  /// Fills the per quadrature point arrays before the off diagonal Jacobian loop
+  virtual void precalculateOffDiagJacobian(unsigned int jvar) override;
+
   /// Required residual function for standard kernels in MOOSE
   /** This function returns a residual contribution for this object.*/
   virtual Real computeQpResidual();
@@ -62,5 +82,14 @@ protected:
   const VariableValue & _specarea;    ///< Variable for specific area (m^-1)
   const unsigned int _specarea_var;   ///< Variable identification for specific area
 
-private:
+  /// Treatment of the interphase exchange in the Jacobian
+  /** 'full' adds d(Res)/d(T_other), 'diagonal' drops it so that the preconditioning matrix of
+    a two-temperature model is block diagonal (the residual is unchanged). */
+  const enum class ExchangeJacobian { full, diagonal } _exchange_jacobian;
+
+  std::vector<Real> _qp_coef;  ///< h * A * fv at each quadrature point of the element
+  std::vector<Real> _qp_dtemp; ///< T - T_other at each quadrature point of the element
+
+  /// Fills the per quadrature point arrays for the current element
+  void precomputeQpData();
 };
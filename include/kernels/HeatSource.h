@@ -6,6 +6,8 @@
  *                  Res = test * v
  *                          where v = coupled heat source (in W/m^3)
  *
+ *            The diagonal Jacobian is zero, so its element loop is skipped unless diag_save_in
+ *            is used.
  *
  *  \author Austin Ladshaw
  *  \date 12/09/2023
@@ -15,6 +17,8 @@
 #pragma once
 
 #include "Kernel.h"
+#include "TealProfilingInterface.h"
+#include "TealOffDiagonalInterface.h"
 
 /// HeatSource class object inherits from Kernel object
 /** This class object inherits from the Kernel object in the MOOSE framework.
@@ -22,7 +26,9 @@
     The kernel adds the following physics:
       Res = test * v
 */
-class HeatSource : public Kernel
+class HeatSource : public Kernel,
+                   public TealProfilingInterface,
+                   public TealOffDiagonalInterface
 {
 public:
   /// Required new syntax for InputParameters
@@ -32,6 +38,15 @@ public:
   HeatSource(const InputParameters & parameters);
 
 protected:
+  /// Element residual (timed and counted when profiling)
+  virtual void computeResidual() override;
+  /// Element Jacobian (timed and counted when profiling)
+  virtual void computeJacobian() override;
+  /// Element off diagonal Jacobian (timed when profiling)
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+  /// Finds the nonlinear coupled variables (off diagonal blocks of all others are skipped)
+  virtual void initialSetup() override;
+
   /// Required residual function for standard kernels in MOOSE
   /** This function returns a residual contribution for this object.*/
   virtual Real computeQpResidual();
@@ -50,6 +65,4 @@ protected:
 
   const VariableValue & _coupled_source;  ///< Coupled variable (W/m^3)
   const unsigned int _coupled_source_var; ///< Variable identification for the coupled variable
-
-private:
 };
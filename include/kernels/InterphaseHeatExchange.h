@@ -0,0 +1,94 @@
+/*!
+ *  \file InterphaseHeatExchange.h
+ *  \brief Kernel for the exchange of thermal energy between two phases in a single pass
+ *  \details This file creates a kernel that couples a pair of heat variables in the same
+ *            domain as a form of convective transfer, and assembles both of them:
+ *                  Res(T) = test * h * A * fv * (T - T_other)
+ *                  Res(T_other) = - Res(T)
+ *                          where T = temperature of this heat variable's phase (K)
+ *                          and T_other = temperature of the other heat variable's phase (K)
+ *                          h = heat transfer coefficient (W/m^2/K)
+ *                          A = specific contact area per volume between the phases (m^-1)
+ *                              = area of solids per volume of solids
+ *                          fv = volume fraction of the phases (volume solids / total volume)
+ *
+ *            This replaces the pair of HeatConvection kernels of a two-temperature model.
+ *            The coefficient h * A * fv is evaluated once per quadrature point, and the
+ *            element residual and the 2x2 block of exchange Jacobians are formed once and
+ *            written to the rows of both variables.
+ *
+ *  \note The other temperature must be a nonlinear variable of the same finite element type.
+ *        The cross blocks are only kept by the preconditioner when they are part of the
+ *        coupling (e.g. SMP with full = true).
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "Kernel.h"
+#include "TealProfilingInterface.h"
+#include "TealOffDiagonalInterface.h"
+
+/// InterphaseHeatExchange class object inherits from Kernel object
+/** This class object inherits from the Kernel object in the MOOSE framework.
+
+    The kernel adds the following physics to both temperatures:
+      Res(T) = test * h * A * fv * (T - T_other),  Res(T_other) = - Res(T)
+*/
+class InterphaseHeatExchange : public Kernel,
+                               public TealProfilingInterface,
+                               public TealOffDiagonalInterface
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  InterphaseHeatExchange(const InputParameters & parameters);
+
+protected:
+  /// Element residual of both temperatures
+  virtual void computeResidual() override;
+  /// Element Jacobian diagonal blocks of both temperatures
+  virtual void computeJacobian() override;
+  /// Element Jacobian blocks of both temperatures for the column variable jvar
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+  /// Finds the nonlinear coupled variables (off diagonal blocks of all others are skipped)
+  virtual void initialSetup() override;
+
+  /// Not used by the element loops
+  virtual Real computeQpResidual() override { return 0.0; }
+
+  const MooseVariable & _other_var;   ///< Other phase temperature variable
+  const VariableValue & _hs;          ///< Variable for Heat transfer coefficient (W/m^2/K)
+  const unsigned int _hs_var;         ///< Variable identification for hw
+  const VariableValue & _other_temp;  ///< Variable for other phase temperature (K)
+  const unsigned int _other_temp_var; ///< Variable identification for other phase temperature
+  const VariableValue & _volfrac;     ///< Variable for volume fraction (-)
+  const unsigned int _volfrac_var;    ///< Variable identification for volume fraction
+  const VariableValue & _specarea;    ///< Variable for specific area (m^-1)
+  const unsigned int _specarea_var;   ///< Variable identification for specific area
+
+  /// Treatment of the interphase exchange in the Jacobian
+  /** 'full' adds the cross blocks d(Res(T))/d(T_other) and d(Res(T_other))/d(T), 'diagonal'
+    drops them so that the preconditioning matrix is block diagonal (the residual is
+    unchanged). */
+  const enum class ExchangeJacobian { full, diagonal } _exchange_jacobian;
+
+  std::vector<Real> _qp_coef;       ///< JxW * coord * h * A * fv at each quadrature point
+  DenseVector<Number> _exchange_re; ///< Exchange residual of the rows of this variable
+  DenseMatrix<Number> _exchange_ke; ///< test * h * A * fv * phi, shared by all four blocks
+
+  /// Fills the per quadrature point coefficient for the current element
+  void precomputeQpData();
+
+  /// Fills the exchange matrix test * h * A * fv * phi for the current element
+  void computeExchangeMatrix();
+
+  /// Adds the exchange matrix times sign to the Jacobian block (ivar, jvar)
+  void addExchangeBlock(unsigned int ivar, unsigned int jvar, Real sign);
+
+};
@@ -0,0 +1,84 @@
+/*!
+ *  \file SumFactorizedHeatAccumulation.h
+ *	\brief Sum factorized heat accumulation kernel for HEX27 elements
+ *	\details This file creates a heat accumulation kernel on second order HEX27 elements,
+ *				with the same physics as HeatAccumulation (and a consistent mass matrix):
+ *						Res = test * fv * rho * cp * dTdt
+ *								where fv = volume fraction (-)
+ *									  rho = material density (kg/m^3)
+ *									  cp = heat capacity of the material (J/kg/K)
+ *									  dTdt = internal heat rate change (K/s)
+ *
+ *			The element residual is applied without forming the element mass matrix: the
+ *			nodal dTdt is interpolated to the 3 x 3 x 3 Gauss points by sum factorization
+ *			(see TealHex27SumFactorization), and the weighted values are integrated against
+ *			the test functions by the transposed sweeps.
+ *
+ *			Only the diagonal of the consistent mass matrix is assembled, as a Jacobi
+ *			preconditioner for PJFNK solves (e.g., '-pc_type jacobi'), where the operator is
+ *			applied through the residual. This differs from 'lumped_mass' of
+ *			HeatAccumulation, which also lumps the residual. The temperature derivative of
+ *			'rho_cp_eps' and the coupling to the property variables are left out of the
+ *			preconditioner. The matrix is still allocated with the full sparsity pattern of
+ *			the DofMap.
+ *
+ * 	\note Requires a SECOND order LAGRANGE variable on HEX27 elements with the default
+ *			quadrature (3 Gauss points per direction).
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "TimeKernel.h"
+#include "TealProfilingInterface.h"
+#include "TealThermalPropertiesInterface.h"
+#include "TealHex27SumFactorization.h"
+#include "TealSaveIn.h"
+
+/// SumFactorizedHeatAccumulation class object inherits from TimeKernel object
+/** This class object inherits from the TimeKernel object in the MOOSE framework.
+
+    The kernel adds the following physics on HEX27 elements:
+      Res = test * fv * rho * cp * dTdt
+*/
+class SumFactorizedHeatAccumulation : public TealThermalPropertiesInterface<TimeKernel>,
+                                      public TealProfilingInterface
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  SumFactorizedHeatAccumulation(const InputParameters & parameters);
+
+protected:
+  /// Sum factorized element residual
+  virtual void computeResidual() override;
+  /// Diagonal of the element Jacobian
+  virtual void computeJacobian() override;
+  /// Only the diagonal block (the preconditioner has no off diagonal blocks)
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+  /// Starts the save_in buffers of the residual loop
+  virtual void residualSetup() override;
+  /// Starts the diag_save_in buffers of the Jacobian loop
+  virtual void jacobianSetup() override;
+
+  /// Not used by the sum factorized element loop
+  virtual Real computeQpResidual() override { return 0.0; }
+
+  /// Checks the element and fills fv * rho * cp at each quadrature point
+  void precomputeElementData();
+
+  const VariableValue & _u_dot_nodal; ///< Nodal time derivative of the temperature (K/s)
+
+  std::vector<Real> _qp_rho_cp_eps; ///< fv * rho * cp at each quadrature point of the element
+
+  /// Tensor product tables of the element (built on the first element)
+  TealHex27SumFactorization _sum_factorization;
+
+  /// save_in and diag_save_in of the element loops
+  TealSaveIn _teal_save_in;
+};
@@ -0,0 +1,81 @@
+/*!
+ *  \file SumFactorizedHeatConduction.h
+ *  \brief Sum factorized heat conduction kernel for HEX27 elements
+ *  \details This file creates a kernel for the conduction of heat on second order
+ *            HEX27 elements, with the same physics as HeatConduction:
+ *                  Res = grad_test * grad_u * K * fv
+ *                          where K = thermal conductivity (in W/m/K)
+ *							and   fv = volume fraction (-)
+ *
+ *            The element residual is applied without forming the element matrix: the
+ *            reference gradients of the temperature and of the element map are found at the
+ *            3 x 3 x 3 Gauss points by sum factorization (see TealHex27SumFactorization),
+ *            the flux is formed at each point, and is integrated against the reference test
+ *            gradients by the transposed sweeps.
+ *
+ *            Only the diagonal of the element Jacobian is assembled, as a Jacobi
+ *            preconditioner for PJFNK solves (e.g., '-pc_type jacobi'), where the operator
+ *            is applied through the residual. The temperature derivative of 'k_eps' and the
+ *            coupling to the property variables are left out of the preconditioner. The
+ *            matrix is still allocated with the full sparsity pattern of the DofMap.
+ *
+ *  \note Requires a SECOND order LAGRANGE variable on HEX27 elements with the default
+ *			quadrature (3 Gauss points per direction).
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "Kernel.h"
+#include "TealProfilingInterface.h"
+#include "TealThermalPropertiesInterface.h"
+#include "TealHex27SumFactorization.h"
+#include "TealSaveIn.h"
+
+/// SumFactorizedHeatConduction class object inherits from Kernel object
+/** This class object inherits from the Kernel object in the MOOSE framework.
+
+    The kernel adds the following physics on HEX27 elements:
+      Res = grad_test * grad_u * K * fv
+*/
+class SumFactorizedHeatConduction : public TealThermalPropertiesInterface<Kernel>,
+                                    public TealProfilingInterface
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  SumFactorizedHeatConduction(const InputParameters & parameters);
+
+protected:
+  /// Sum factorized element residual
+  virtual void computeResidual() override;
+  /// Diagonal of the element Jacobian
+  virtual void computeJacobian() override;
+  /// Only the diagonal block (the preconditioner has no off diagonal blocks)
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+  /// Starts the save_in buffers of the residual loop
+  virtual void residualSetup() override;
+  /// Starts the diag_save_in buffers of the Jacobian loop
+  virtual void jacobianSetup() override;
+
+  /// Not used by the sum factorized element loop
+  virtual Real computeQpResidual() override { return 0.0; }
+
+  /// Checks the element and fills fv * K at each quadrature point
+  void precomputeElementData();
+
+  const VariableValue & _u_nodal; ///< Nodal values of the temperature (K)
+
+  std::vector<Real> _qp_k_eps; ///< fv * K at each quadrature point of the element
+
+  /// Tensor product tables of the element (built on the first element)
+  TealHex27SumFactorization _sum_factorization;
+
+  /// save_in and diag_save_in of the element loops
+  TealSaveIn _teal_save_in;
+};
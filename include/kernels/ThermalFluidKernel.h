@@ -0,0 +1,132 @@
+/*!
+ *  \file ThermalFluidKernel.h
+ *	\brief Kernel combining heat accumulation, conduction, and advection in a single element pass
+ *	\details This file creates a fused thermal fluid kernel that evaluates the accumulation,
+ *				conduction, and conservative advection physics in one element loop:
+ *						Res = test * fv * rho * cp * dTdt
+ *							+ grad_test * grad_u * K * fv
+ *							- grad_test * fv * vel * rho * cp * T
+ *								where fv = volume fraction (-)
+ *									  rho = material density (kg/m^3)
+ *									  cp = heat capacity of the material (J/kg/K)
+ *									  K = thermal conductivity (W/m/K)
+ *									  T = temperature of the fluid (K)
+ *									  vel = velocity of the fluid (m/s)
+ *
+ *			The product fv * rho * cp, the velocity, and the quadrature weights are formed
+ *			once per quadrature point and shared between the three terms. This gives the
+ *			same result as stacking HeatAccumulation, HeatConduction, and
+ *			HeatAdvectionConservative on the same variable (with the same volume fraction).
+ *
+ * 	\note This REQUIRES use with ThermalFluidFluxBC due to Gauss Divergence
+ *
+ * 	\note Since all terms are tagged as time terms, this kernel is only correct for the
+ *			implicit-euler and bdf2 time integration schemes, and reports an error for others.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "TimeKernel.h"
+#include "DerivativeMaterialInterface.h"
+#include "TealProfilingInterface.h"
+#include "TealOffDiagonalInterface.h"
+#include "TealThermalPropertiesInterface.h"
+#include "TealSaveIn.h"
+
+/// ThermalFluidKernel class object inherits from TimeKernel object
+/** This class object inherits from the TimeKernel object in the MOOSE framework.
+
+    The kernel adds the following physics:
+      Res = test * fv * rho * cp * dTdt + grad_test * grad_u * K * fv
+            - grad_test * fv * vel * rho * cp * T
+
+    Options for numerical stabilization of the advection term are: none; full upwinding
+*/
+class ThermalFluidKernel
+  : public TealThermalPropertiesInterface<DerivativeMaterialInterface<TimeKernel>>,
+    public TealProfilingInterface,
+    public TealOffDiagonalInterface
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ThermalFluidKernel(const InputParameters & parameters);
+
+protected:
+  /// Element off diagonal Jacobian (timed when profiling)
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+  /// Checks the time scheme and finds the nonlinear coupled variables (for off diagonal blocks)
+  virtual void initialSetup() override;
+  /// Starts the save_in buffers of the residual loop
+  virtual void residualSetup() override;
+  /// Starts the diag_save_in buffers of the Jacobian loop
+  virtual void jacobianSetup() override;
+
+  /// Residual integrand of all three terms without upwinding (not used by the element loops)
+  virtual Real computeQpResidual() override;
+  /// Jacobian integrand of all three terms without upwinding (not used by the element loops)
+  virtual Real computeQpJacobian() override;
+  /// Off diagonal Jacobian integrand for the coupled properties and velocities
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  /// Fused element loop for the residual
+  virtual void computeResidual() override;
+  /// Fused element loop for the Jacobian
+  virtual void computeJacobian() override;
+
+  const VariableValue & _ux;  ///< Velocity in the x-direction (m/s)
+  const unsigned int _ux_var; ///< Variable identification for ux
+  const VariableValue & _uy;  ///< Velocity in the y-direction (m/s)
+  const unsigned int _uy_var; ///< Variable identification for uy
+  const VariableValue & _uz;  ///< Velocity in the z-direction (m/s)
+  const unsigned int _uz_var; ///< Variable identification for uz
+
+  /// Derivative of the material property fv * rho * cp with respect to this variable
+  const MaterialProperty<Real> * const _drho_cp_eps;
+  /// Derivative of the material property fv * K with respect to this variable
+  const MaterialProperty<Real> * const _dk_eps;
+
+  /// Type of upwinding
+  const enum class UpwindingType { none, full } _upwinding;
+
+  /// Nodal value of u, used for full upwinding
+  const VariableValue & _u_nodal;
+
+  std::vector<Real> _qp_jxw;            ///< JxW * coord at each quadrature point of the element
+  std::vector<Real> _qp_rho_cp_eps;     ///< fv * rho * cp at each quadrature point of the element
+  std::vector<Real> _qp_k_eps;          ///< fv * K at each quadrature point of the element
+  std::vector<Real> _qp_drho_cp_eps;    ///< d(fv * rho * cp)/du at each quadrature point
+  std::vector<Real> _qp_dk_eps;         ///< d(fv * K)/du at each quadrature point
+  std::vector<RealVectorValue> _qp_vel; ///< Velocity at each quadrature point of the element
+
+  /// In the full-upwind scheme, the outflux from each node
+  std::vector<Real> _outflux;
+  /// In the full-upwind scheme, whether a node is an upwind node
+  std::vector<bool> _upwind_node;
+  /// In the full-upwind scheme, d(total_mass_out)/d(variable_at_node_j)
+  std::vector<Real> _dtotal_mass_out;
+  /// In the full-upwind scheme, d(total_in)/d(variable_at_node_j) from the property derivative
+  std::vector<Real> _dtotal_in;
+  /// In the full-upwind scheme, d(outflux_i)/d(variable_at_node_j) from the property derivative
+  DenseMatrix<Number> _doutflux;
+
+  /// Fills the per quadrature point coefficient arrays for the current element
+  void precomputeQpData();
+
+  /// Computes the outflux from every node of the element for the full-upwind scheme
+  void computeNodalOutflux();
+
+  /// Computes the derivative of the outflux from every node through d(fv * rho * cp)/du
+  void computeNodalOutfluxDerivative();
+
+  const PerfID _full_upwind_timer; ///< PerfGraph section for the full upwinding outflux
+
+  /// save_in and diag_save_in of the fused element loops
+  TealSaveIn _teal_save_in;
+};
@@ -0,0 +1,90 @@
+/*!
+ *  \file TransferredHeatExchange.h
+ *  \brief Kernel for the exchange of thermal energy with a phase solved in another app
+ *  \details This file creates a kernel for the convective exchange of heat with a phase
+ *            whose temperature is solved by another (sub-cycled) MultiApp, with the fields
+ *            of that phase transferred into auxiliary variables. It has two forms:
+ *
+ *            (1) The app that sub-cycles (e.g. the fluid) uses the transferred temperature
+ *                and exchange coefficient:
+ *                  Res = test * hA * (T - T_other)
+ *                          where hA = h * A * fv, product of the heat transfer coefficient,
+ *                              specific area and volume fraction (W/K/m^3)
+ *                          and T_other = transferred temperature of the other phase (K)
+ *
+ *            (2) The app with the long time steps (e.g. the solid) uses the energy that
+ *                crossed the interface during its step, as summed over the sub-cycles by
+ *                ExchangedHeatAux and transferred back:
+ *                  Res = test * (E - E_old) / dt
+ *                          where E = cumulative energy per volume given to the other
+ *                              phase (J/m^3), and E_old its value at the previous step
+ *
+ *            Both apps then see exactly the same exchanged energy over each long step, so
+ *            the coupling conserves energy while the solid is never solved at the fluid
+ *            time step. The exchange is lagged (explicit) for the solid only.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "Kernel.h"
+#include "TealProfilingInterface.h"
+#include "TealOffDiagonalInterface.h"
+
+/// TransferredHeatExchange class object inherits from Kernel object
+/** This class object inherits from the Kernel object in the MOOSE framework.
+
+    The kernel adds one of the following physics:
+      Res = test * hA * (T - T_other)   or   Res = test * (E - E_old) / dt
+*/
+class TransferredHeatExchange : public Kernel,
+                                public TealProfilingInterface,
+                                public TealOffDiagonalInterface
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  TransferredHeatExchange(const InputParameters & parameters);
+
+protected:
+  /// Element residual (timed and counted when profiling)
+  virtual void computeResidual() override;
+  /// Element Jacobian (timed and counted when profiling)
+  virtual void computeJacobian() override;
+  /// Element off diagonal Jacobian (timed when profiling)
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+  /// Finds the nonlinear coupled variables (off diagonal blocks of all others are skipped)
+  virtual void initialSetup() override;
+
+  /// Required residual function for standard kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual Real computeQpResidual() override;
+
+  /// Required Jacobian function for standard kernels in MOOSE
+  /** This function returns a Jacobian contribution for this object. The Jacobian being
+   computed is the associated diagonal element in the overall Jacobian matrix for the
+   system and is used in preconditioning of the linear sub-problem. */
+  virtual Real computeQpJacobian() override;
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. By
+   returning a non-zero value we will hopefully improve the convergence rate for the
+   cross coupling of the variables. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  /// True if the exchanged energy of the other app is given (form 2)
+  const bool _use_exchanged_energy;
+
+  const VariableValue & _hA;          ///< Variable for h * A * fv (W/K/m^3)
+  const unsigned int _hA_var;         ///< Variable identification for h * A * fv
+  const VariableValue & _other_temp;  ///< Variable for other phase temperature (K)
+  const unsigned int _other_temp_var; ///< Variable identification for other phase temperature
+  const VariableValue & _energy;      ///< Cumulative exchanged energy per volume (J/m^3)
+  const VariableValue & _energy_old;  ///< Cumulative exchanged energy at the previous step
+
+};
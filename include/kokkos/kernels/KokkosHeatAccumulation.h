@@ -0,0 +1,101 @@
+/*!
+ *  \file KokkosHeatAccumulation.h
+ *	\brief Kokkos kernel to create a heat accumulation kernel for thermal dynamics
+ *	\details This file creates a heat accumulation kernel for thermal dynamics
+ *				and introduces the following phyiscs:
+ *						Res = test * fv * rho * cp * dTdt
+ *								where fv = volume fraction (-)
+ *									  rho = material density (kg/m^3)
+ *									  cp = heat capacity of the material (J/kg/K)
+ *									  dTdt = internal heat rate change (K/s)
+ *
+ *			This is the Kokkos version of HeatAccumulation, built when MOOSE is configured with
+ *			Kokkos and added in the [KokkosKernels] block. Its residual and Jacobian are
+ *			evaluated on the device, where MOOSE keeps the solution, the coupled property
+ *			variables, and the shape functions. The properties are only read from coupled
+ *			variables ('rho_cp_eps' and 'k_eps' materials are not supported).
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "KokkosTimeKernel.h"
+
+/// KokkosHeatAccumulation class object inherits from the Kokkos TimeKernel object
+/** The kernel adds the following physics:
+      Res = test * fv * rho * cp * dTdt
+*/
+class KokkosHeatAccumulation : public Moose::Kokkos::TimeKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  KokkosHeatAccumulation(const InputParameters & parameters);
+
+  /// Residual at a quadrature point, evaluated on the device
+  KOKKOS_FUNCTION Real
+  computeQpResidual(const unsigned int i, const unsigned int qp, AssemblyDatum & datum) const;
+
+  /// Jacobian at a quadrature point, evaluated on the device
+  KOKKOS_FUNCTION Real computeQpJacobian(const unsigned int i,
+                                         const unsigned int j,
+                                         const unsigned int qp,
+                                         AssemblyDatum & datum) const;
+
+  /// Off diagonal Jacobian for the property variables, evaluated on the device
+  KOKKOS_FUNCTION Real computeQpOffDiagJacobian(const unsigned int i,
+                                                const unsigned int j,
+                                                const unsigned int jvar,
+                                                const unsigned int qp,
+                                                AssemblyDatum & datum) const;
+
+protected:
+  const Moose::Kokkos::VariableValue _density;  ///< Density variable (kg/m^3)
+  const unsigned int _density_var;              ///< Variable identification for density
+  const Moose::Kokkos::VariableValue _heat_cap; ///< Heat capacity variable (J/kg/K)
+  const unsigned int _heat_cap_var;             ///< Variable identification for heat capacity
+  const Moose::Kokkos::VariableValue _volfrac;  ///< Volume fraction variable (-)
+  const unsigned int _volfrac_var;              ///< Variable identification for volume fraction
+};
+
+KOKKOS_FUNCTION inline Real
+KokkosHeatAccumulation::computeQpResidual(const unsigned int i,
+                                          const unsigned int qp,
+                                          AssemblyDatum & datum) const
+{
+  return _test(datum, i, qp) * _density(datum, qp) * _heat_cap(datum, qp) * _volfrac(datum, qp) *
+         _u_dot(datum, qp);
+}
+
+KOKKOS_FUNCTION inline Real
+KokkosHeatAccumulation::computeQpJacobian(const unsigned int i,
+                                          const unsigned int j,
+                                          const unsigned int qp,
+                                          AssemblyDatum & datum) const
+{
+  return _test(datum, i, qp) * _density(datum, qp) * _heat_cap(datum, qp) * _volfrac(datum, qp) *
+         _phi(datum, j, qp) * _du_dot_du;
+}
+
+KOKKOS_FUNCTION inline Real
+KokkosHeatAccumulation::computeQpOffDiagJacobian(const unsigned int i,
+                                                 const unsigned int j,
+                                                 const unsigned int jvar,
+                                                 const unsigned int qp,
+                                                 AssemblyDatum & datum) const
+{
+  // Summed, in case the same variable is coupled to more than one input
+  Real d = 0.0;
+  if (jvar == _density_var)
+    d += _heat_cap(datum, qp) * _volfrac(datum, qp);
+  if (jvar == _heat_cap_var)
+    d += _density(datum, qp) * _volfrac(datum, qp);
+  if (jvar == _volfrac_var)
+    d += _density(datum, qp) * _heat_cap(datum, qp);
+  return d * _phi(datum, j, qp) * _test(datum, i, qp) * _u_dot(datum, qp);
+}
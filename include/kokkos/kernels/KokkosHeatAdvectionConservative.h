@@ -0,0 +1,138 @@
+/*!
+ *  \file KokkosHeatAdvectionConservative.h
+ *	\brief Kokkos kernel to create heat advection physics without upwinding
+ *	\details This file creates a heat advection kernel without upwinding
+ *				and introduces the following phyiscs:
+ *						Res = -grad_test * fv * vel * rho * cp * T
+ *								where fv = volume fraction (-)
+ *									  rho = material density (kg/m^3)
+ *									  cp = heat capacity of the material (J/kg/K)
+ *									  T = temperature of the fluid (K)
+ *									  vel = velocity of the fluid (m/s)
+ *
+ *			This is the Kokkos version of HeatAdvectionConservative, built when MOOSE is configured with
+ *			Kokkos and added in the [KokkosKernels] block. Its residual and Jacobian are
+ *			evaluated on the device, where MOOSE keeps the solution, the coupled property
+ *			variables, and the shape functions. The properties are only read from coupled
+ *			variables ('rho_cp_eps' and 'k_eps' materials are not supported).
+ *
+ *			Only the 'upwinding_type = none' path of HeatAdvectionConservative is ported, since
+ *			the full upwinding loops over the nodes of each element rather than its
+ *			quadrature points.
+ *
+ * 	\note This REQUIRES use with ThermalFluidFluxBC due to Gauss Divergence
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "KokkosKernel.h"
+
+/// KokkosHeatAdvectionConservative class object inherits from the Kokkos Kernel object
+/** The kernel adds the following physics:
+      Res = -grad_test * fv * vel * rho * cp * T
+*/
+class KokkosHeatAdvectionConservative : public Moose::Kokkos::Kernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  KokkosHeatAdvectionConservative(const InputParameters & parameters);
+
+  /// Residual at a quadrature point, evaluated on the device
+  KOKKOS_FUNCTION Real
+  computeQpResidual(const unsigned int i, const unsigned int qp, AssemblyDatum & datum) const;
+
+  /// Jacobian at a quadrature point, evaluated on the device
+  KOKKOS_FUNCTION Real computeQpJacobian(const unsigned int i,
+                                         const unsigned int j,
+                                         const unsigned int qp,
+                                         AssemblyDatum & datum) const;
+
+  /// Off diagonal Jacobian for the velocity and property variables, on the device
+  KOKKOS_FUNCTION Real computeQpOffDiagJacobian(const unsigned int i,
+                                                const unsigned int j,
+                                                const unsigned int jvar,
+                                                const unsigned int qp,
+                                                AssemblyDatum & datum) const;
+
+protected:
+  /// fv * rho * cp at a quadrature point (J/m^3/K)
+  KOKKOS_FUNCTION Real rhoCpEps(const unsigned int qp, AssemblyDatum & datum) const
+  {
+    return _density(datum, qp) * _heat_cap(datum, qp) * _volfrac(datum, qp);
+  }
+
+  /// grad_test * vel at a quadrature point
+  KOKKOS_FUNCTION Real
+  gradTestDotVel(const unsigned int i, const unsigned int qp, AssemblyDatum & datum) const
+  {
+    const auto grad_test = _grad_test(datum, i, qp);
+    return grad_test(0) * _ux(datum, qp) + grad_test(1) * _uy(datum, qp) +
+           grad_test(2) * _uz(datum, qp);
+  }
+
+  const Moose::Kokkos::VariableValue _ux;       ///< Velocity in the x-direction (m/s)
+  const unsigned int _ux_var;                   ///< Variable identification for ux
+  const Moose::Kokkos::VariableValue _uy;       ///< Velocity in the y-direction (m/s)
+  const unsigned int _uy_var;                   ///< Variable identification for uy
+  const Moose::Kokkos::VariableValue _uz;       ///< Velocity in the z-direction (m/s)
+  const unsigned int _uz_var;                   ///< Variable identification for uz
+  const Moose::Kokkos::VariableValue _density;  ///< Density variable (kg/m^3)
+  const unsigned int _density_var;              ///< Variable identification for density
+  const Moose::Kokkos::VariableValue _heat_cap; ///< Heat capacity variable (J/kg/K)
+  const unsigned int _heat_cap_var;             ///< Variable identification for heat capacity
+  const Moose::Kokkos::VariableValue _volfrac;  ///< Volume fraction variable (-)
+  const unsigned int _volfrac_var;              ///< Variable identification for volume fraction
+};
+
+KOKKOS_FUNCTION inline Real
+KokkosHeatAdvectionConservative::computeQpResidual(const unsigned int i,
+                                                   const unsigned int qp,
+                                                   AssemblyDatum & datum) const
+{
+  return -gradTestDotVel(i, qp, datum) * rhoCpEps(qp, datum) * _u(datum, qp);
+}
+
+KOKKOS_FUNCTION inline Real
+KokkosHeatAdvectionConservative::computeQpJacobian(const unsigned int i,
+                                                   const unsigned int j,
+                                                   const unsigned int qp,
+                                                   AssemblyDatum & datum) const
+{
+  return -gradTestDotVel(i, qp, datum) * rhoCpEps(qp, datum) * _phi(datum, j, qp);
+}
+
+KOKKOS_FUNCTION inline Real
+KokkosHeatAdvectionConservative::computeQpOffDiagJacobian(const unsigned int i,
+                                                          const unsigned int j,
+                                                          const unsigned int jvar,
+                                                          const unsigned int qp,
+                                                          AssemblyDatum & datum) const
+{
+  const Real u_phi = _u(datum, qp) * _phi(datum, j, qp);
+  const auto grad_test = _grad_test(datum, i, qp);
+
+  // Summed, in case the same variable is coupled to more than one input
+  Real d = 0.0;
+  if (jvar == _ux_var)
+    d -= u_phi * grad_test(0) * rhoCpEps(qp, datum);
+  if (jvar == _uy_var)
+    d -= u_phi * grad_test(1) * rhoCpEps(qp, datum);
+  if (jvar == _uz_var)
+    d -= u_phi * grad_test(2) * rhoCpEps(qp, datum);
+
+  Real drho_cp_eps = 0.0;
+  if (jvar == _density_var)
+    drho_cp_eps += _heat_cap(datum, qp) * _volfrac(datum, qp);
+  if (jvar == _heat_cap_var)
+    drho_cp_eps += _density(datum, qp) * _volfrac(datum, qp);
+  if (jvar == _volfrac_var)
+    drho_cp_eps += _density(datum, qp) * _heat_cap(datum, qp);
+  return d - u_phi * gradTestDotVel(i, qp, datum) * drho_cp_eps;
+}
@@ -0,0 +1,95 @@
+/*!
+ *  \file KokkosHeatConduction.h
+ *	\brief Kokkos kernel for creating a heat conduction
+ *	\details This file creates a kernel for the conduction of heat
+ *            in an energy balance equation as shown below:
+ *                  Res = grad_test * grad_u * K * fv
+ *                          where K = thermal conductivity (in W/m/K)
+ *							and   fv = volume fraction (-)
+ *
+ *			This is the Kokkos version of HeatConduction, built when MOOSE is configured with
+ *			Kokkos and added in the [KokkosKernels] block. Its residual and Jacobian are
+ *			evaluated on the device, where MOOSE keeps the solution, the coupled property
+ *			variables, and the shape functions. The properties are only read from coupled
+ *			variables ('rho_cp_eps' and 'k_eps' materials are not supported).
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "KokkosKernel.h"
+
+/// KokkosHeatConduction class object inherits from the Kokkos Kernel object
+/** The kernel adds the following physics:
+      Res = grad_test * grad_u * K * fv
+*/
+class KokkosHeatConduction : public Moose::Kokkos::Kernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  KokkosHeatConduction(const InputParameters & parameters);
+
+  /// Residual at a quadrature point, evaluated on the device
+  KOKKOS_FUNCTION Real
+  computeQpResidual(const unsigned int i, const unsigned int qp, AssemblyDatum & datum) const;
+
+  /// Jacobian at a quadrature point, evaluated on the device
+  KOKKOS_FUNCTION Real computeQpJacobian(const unsigned int i,
+                                         const unsigned int j,
+                                         const unsigned int qp,
+                                         AssemblyDatum & datum) const;
+
+  /// Off diagonal Jacobian for the property variables, evaluated on the device
+  KOKKOS_FUNCTION Real computeQpOffDiagJacobian(const unsigned int i,
+                                                const unsigned int j,
+                                                const unsigned int jvar,
+                                                const unsigned int qp,
+                                                AssemblyDatum & datum) const;
+
+protected:
+  const Moose::Kokkos::VariableValue _conductivity; ///< Thermal conductivity variable (W/m/K)
+  const unsigned int _conductivity_var;             ///< Variable identification for conductivity
+  const Moose::Kokkos::VariableValue _volfrac;      ///< Volume fraction variable (-)
+  const unsigned int _volfrac_var;                  ///< Variable identification for volume fraction
+};
+
+KOKKOS_FUNCTION inline Real
+KokkosHeatConduction::computeQpResidual(const unsigned int i,
+                                        const unsigned int qp,
+                                        AssemblyDatum & datum) const
+{
+  return _conductivity(datum, qp) * _volfrac(datum, qp) *
+         (_grad_test(datum, i, qp) * _grad_u(datum, qp));
+}
+
+KOKKOS_FUNCTION inline Real
+KokkosHeatConduction::computeQpJacobian(const unsigned int i,
+                                        const unsigned int j,
+                                        const unsigned int qp,
+                                        AssemblyDatum & datum) const
+{
+  return _conductivity(datum, qp) * _volfrac(datum, qp) *
+         (_grad_test(datum, i, qp) * _grad_phi(datum, j, qp));
+}
+
+KOKKOS_FUNCTION inline Real
+KokkosHeatConduction::computeQpOffDiagJacobian(const unsigned int i,
+                                               const unsigned int j,
+                                               const unsigned int jvar,
+                                               const unsigned int qp,
+                                               AssemblyDatum & datum) const
+{
+  // Summed, in case the same variable is coupled to both inputs
+  Real d = 0.0;
+  if (jvar == _conductivity_var)
+    d += _volfrac(datum, qp);
+  if (jvar == _volfrac_var)
+    d += _conductivity(datum, qp);
+  return d * _phi(datum, j, qp) * (_grad_test(datum, i, qp) * _grad_u(datum, qp));
+}
@@ -0,0 +1,107 @@
+/*!
+ *  \file KokkosHeatConvection.h
+ *	\brief Kokkos kernel for the convective exchange of heat between phases
+ *	\details This file creates a kernel for the convective exchange of heat
+ *				with another phase in an energy balance equation as shown below:
+ *						Res = test * h * A * fv * (T - T_other)
+ *								where h = heat transfer coefficient (W/m^2/K)
+ *									  A = specific area (m^-1)
+ *									  fv = volume fraction (-)
+ *									  T_other = temperature of the other phase (K)
+ *
+ *			This is the Kokkos version of HeatConvection, built when MOOSE is configured with
+ *			Kokkos and added in the [KokkosKernels] block. Its residual and Jacobian are
+ *			evaluated on the device, where MOOSE keeps the solution, the coupled property
+ *			variables, and the shape functions. The properties are only read from coupled
+ *			variables ('rho_cp_eps' and 'k_eps' materials are not supported).
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "KokkosKernel.h"
+
+/// KokkosHeatConvection class object inherits from the Kokkos Kernel object
+/** The kernel adds the following physics:
+      Res = test * h * A * fv * (T - T_other)
+*/
+class KokkosHeatConvection : public Moose::Kokkos::Kernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  KokkosHeatConvection(const InputParameters & parameters);
+
+  /// Residual at a quadrature point, evaluated on the device
+  KOKKOS_FUNCTION Real
+  computeQpResidual(const unsigned int i, const unsigned int qp, AssemblyDatum & datum) const;
+
+  /// Jacobian at a quadrature point, evaluated on the device
+  KOKKOS_FUNCTION Real computeQpJacobian(const unsigned int i,
+                                         const unsigned int j,
+                                         const unsigned int qp,
+                                         AssemblyDatum & datum) const;
+
+  /// Off diagonal Jacobian for the other temperature and the coefficients, on the device
+  KOKKOS_FUNCTION Real computeQpOffDiagJacobian(const unsigned int i,
+                                                const unsigned int j,
+                                                const unsigned int jvar,
+                                                const unsigned int qp,
+                                                AssemblyDatum & datum) const;
+
+protected:
+  const Moose::Kokkos::VariableValue _hs;         ///< Heat transfer coefficient (W/m^2/K)
+  const unsigned int _hs_var;                     ///< Variable identification for hs
+  const Moose::Kokkos::VariableValue _other_temp; ///< Temperature of the other phase (K)
+  const unsigned int _other_temp_var;             ///< Variable identification for other_temp
+  const Moose::Kokkos::VariableValue _volfrac;    ///< Volume fraction variable (-)
+  const unsigned int _volfrac_var;                ///< Variable identification for volfrac
+  const Moose::Kokkos::VariableValue _specarea;   ///< Specific area (m^-1)
+  const unsigned int _specarea_var;               ///< Variable identification for specarea
+};
+
+KOKKOS_FUNCTION inline Real
+KokkosHeatConvection::computeQpResidual(const unsigned int i,
+                                        const unsigned int qp,
+                                        AssemblyDatum & datum) const
+{
+  return _test(datum, i, qp) * _hs(datum, qp) * _specarea(datum, qp) * _volfrac(datum, qp) *
+         (_u(datum, qp) - _other_temp(datum, qp));
+}
+
+KOKKOS_FUNCTION inline Real
+KokkosHeatConvection::computeQpJacobian(const unsigned int i,
+                                        const unsigned int j,
+                                        const unsigned int qp,
+                                        AssemblyDatum & datum) const
+{
+  return _test(datum, i, qp) * _hs(datum, qp) * _specarea(datum, qp) * _volfrac(datum, qp) *
+         _phi(datum, j, qp);
+}
+
+KOKKOS_FUNCTION inline Real
+KokkosHeatConvection::computeQpOffDiagJacobian(const unsigned int i,
+                                               const unsigned int j,
+                                               const unsigned int jvar,
+                                               const unsigned int qp,
+                                               AssemblyDatum & datum) const
+{
+  const Real dtemp = _u(datum, qp) - _other_temp(datum, qp);
+
+  // Summed, in case the same variable is coupled to more than one input
+  Real d = 0.0;
+  if (jvar == _other_temp_var)
+    d -= _hs(datum, qp) * _specarea(datum, qp) * _volfrac(datum, qp);
+  if (jvar == _hs_var)
+    d += _specarea(datum, qp) * _volfrac(datum, qp) * dtemp;
+  if (jvar == _volfrac_var)
+    d += _hs(datum, qp) * _specarea(datum, qp) * dtemp;
+  if (jvar == _specarea_var)
+    d += _hs(datum, qp) * _volfrac(datum, qp) * dtemp;
+  return d * _test(datum, i, qp) * _phi(datum, j, qp);
+}
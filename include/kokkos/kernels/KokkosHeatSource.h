@@ -0,0 +1,71 @@
+/*!
+ *  \file KokkosHeatSource.h
+ *	\brief Kokkos kernel for a coupled heat source
+ *	\details This file creates a kernel for a coupled volumetric heat source
+ *				in an energy balance equation as shown below:
+ *						Res = -test * S
+ *								where S = heat source (W/m^3)
+ *
+ *			This is the Kokkos version of HeatSource, built when MOOSE is configured with
+ *			Kokkos and added in the [KokkosKernels] block. Its residual and Jacobian are
+ *			evaluated on the device, where MOOSE keeps the solution, the coupled property
+ *			variables, and the shape functions. The properties are only read from coupled
+ *			variables ('rho_cp_eps' and 'k_eps' materials are not supported).
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This kernel was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "KokkosKernel.h"
+
+/// KokkosHeatSource class object inherits from the Kokkos Kernel object
+/** The kernel adds the following physics:
+      Res = -test * S
+*/
+class KokkosHeatSource : public Moose::Kokkos::Kernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  KokkosHeatSource(const InputParameters & parameters);
+
+  /// Residual at a quadrature point, evaluated on the device
+  KOKKOS_FUNCTION Real
+  computeQpResidual(const unsigned int i, const unsigned int qp, AssemblyDatum & datum) const;
+
+  /// Off diagonal Jacobian for the source variable, evaluated on the device
+  KOKKOS_FUNCTION Real computeQpOffDiagJacobian(const unsigned int i,
+                                                const unsigned int j,
+                                                const unsigned int jvar,
+                                                const unsigned int qp,
+                                                AssemblyDatum & datum) const;
+
+protected:
+  const Moose::Kokkos::VariableValue _coupled_source; ///< Heat source variable (W/m^3)
+  const unsigned int _coupled_source_var;             ///< Variable identification for the source
+};
+
+KOKKOS_FUNCTION inline Real
+KokkosHeatSource::computeQpResidual(const unsigned int i,
+                                    const unsigned int qp,
+                                    AssemblyDatum & datum) const
+{
+  return -_test(datum, i, qp) * _coupled_source(datum, qp);
+}
+
+KOKKOS_FUNCTION inline Real
+KokkosHeatSource::computeQpOffDiagJacobian(const unsigned int i,
+                                           const unsigned int j,
+                                           const unsigned int jvar,
+                                           const unsigned int qp,
+                                           AssemblyDatum & datum) const
+{
+  if (jvar == _coupled_source_var)
+    return -_test(datum, i, qp) * _phi(datum, j, qp);
+  return 0.0;
+}
@@ -0,0 +1,43 @@
+/*!
+ *  \file ThermalFrontMarker.h
+ *  \brief Marker for refining the mesh at thermal fronts and coarsening behind them
+ *  \details This file creates a marker for adaptive mesh refinement that reads the
+ *            temperature jump advected across each element from a ThermalFrontIndicator.
+ *            Elements with a jump above 'refine' (K) are refined, and elements with a jump
+ *            below 'coarsen' (K) are coarsened, so that the number of elements follows the
+ *            front as it moves instead of the size of the domain. Since the thresholds are
+ *            temperatures and not fractions of the error, uniform regions ahead of and
+ *            behind the front are coarsened even when no front is present.
+ *
+ *            HeatAdvectionConservative (all upwinding types) and ThermalFluidFluxBC stay
+ *            conservative on the adapted mesh: full upwinding balances the outflux within
+ *            each element, and the residual of a hanging node is distributed to the nodes
+ *            that constrain it with weights that sum to one.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This marker was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "IndicatorMarker.h"
+
+/// ThermalFrontMarker class object inherits from IndicatorMarker object
+/** Refines where the advected temperature jump is large and coarsens where it is small. */
+class ThermalFrontMarker : public IndicatorMarker
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ThermalFrontMarker(const InputParameters & parameters);
+
+protected:
+  /// Marks the current element from its indicator value
+  virtual MarkerValue computeElementMarker() override;
+
+  const Real _refine;  ///< Temperature jump above which the element is refined (K)
+  const Real _coarsen; ///< Temperature jump below which the element is coarsened (K)
+};
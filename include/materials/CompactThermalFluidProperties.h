@@ -0,0 +1,92 @@
+/*!
+ *  \file CompactThermalFluidProperties.h
+ *	\brief Material object for lumped thermal coefficients stored per element in single precision
+ *	\details This file creates a material object that provides the same lumped thermal
+ *				coefficients as ThermalFluidProperties, but without any property variables:
+ *						rho_cp_eps = fv * rho * cp
+ *						k_eps = fv * K
+ *								where fv = volume fraction (-)
+ *									  rho = material density (kg/m^3)
+ *									  cp = heat capacity of the material (J/kg/K)
+ *									  K = thermal conductivity (W/m/K)
+ *
+ *			Each property is a function of position and time, or a constant. The products
+ *			are evaluated at the vertex average of each active local element of the blocks
+ *			and stored as single precision floats (about 7 significant digits), 16 bytes per
+ *			element with its id. The store is shared by all thread copies of the material and
+ *			is recomputed whenever the time changes (so at most once per time step, instead of
+ *			at every residual and Jacobian evaluation) or the mesh changes. The material is
+ *			computed with constant_on = ELEMENT, so the assembly loops only copy the two
+ *			stored values of each element. The property fields need neither nodal
+ *			AuxVariables nor function evaluations in the assembly loops. The properties are
+ *			constant over each element. Elements that are not in the store (e.g., ghosted
+ *			neighbors) are evaluated directly.
+ *
+ *  \note The velocity is still coupled as variables by the kernels. Use constants, or
+ *			CONSTANT MONOMIAL AuxVariables (one value per element), to make it compact too.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This material was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "Material.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/// CompactThermalFluidProperties class object inherits from Material object
+/** This class object inherits from the Material object in the MOOSE framework.
+
+    Stores fv * rho * cp and fv * K once per element as floats, evaluated from functions. */
+class CompactThermalFluidProperties : public Material
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  CompactThermalFluidProperties(const InputParameters & parameters);
+
+  /// The element ids change with the mesh, so the store is rebuilt
+  virtual void meshChanged() override;
+
+protected:
+  /// Copies the stored values of the current element (refreshing the store if the time changed)
+  virtual void computeQpProperties() override;
+
+  /// Per element values shared by all thread copies of the material
+  struct Store
+  {
+    std::mutex mutex;                         ///< Guards the refresh of the store
+    std::atomic<Real> time;                   ///< Time of the stored values (NaN if stale)
+    bool has_ids = false;                     ///< False until the ids are found for the mesh
+    std::vector<dof_id_type> ids;             ///< Sorted ids of the stored elements
+    std::vector<std::array<float, 2>> values; ///< fv * rho * cp and fv * K of each element
+  };
+
+  /// Evaluates fv * rho * cp and fv * K at the vertex average of an element
+  std::array<Real, 2> evaluateElement(const Elem & elem) const;
+
+  /// Recomputes the stored values at the current time (finding the ids after a mesh change)
+  void refreshStore();
+
+  /// Store shared by the thread copies of the named material on the mesh
+  static std::shared_ptr<Store> sharedStore(const MooseMesh & mesh, const std::string & name);
+
+  const Function & _density;      ///< Function for density (kg/m^3)
+  const Function & _heat_cap;     ///< Function for heat capacity (J/kg/K)
+  const Function & _conductivity; ///< Function for thermal conductivity (W/m/K)
+  const Function & _volfrac;      ///< Function for volume fraction (-)
+
+  MaterialProperty<Real> & _rho_cp_eps; ///< Material property for fv * rho * cp (J/m^3/K)
+  MaterialProperty<Real> & _k_eps;      ///< Material property for fv * K (W/m/K)
+
+  /// Store shared by the thread copies of this material
+  const std::shared_ptr<Store> _store;
+};
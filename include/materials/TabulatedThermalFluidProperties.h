@@ -0,0 +1,72 @@
+/*!
+ *  \file TabulatedThermalFluidProperties.h
+ *	\brief Material object for temperature dependent lumped thermal coefficients
+ *	\details This file creates a material object that evaluates the lumped thermal
+ *				coefficients of a phase from tables of the properties against temperature:
+ *						rho_cp_eps = fv * rho(T) * cp(T)
+ *						k_eps = fv * K(T)
+ *								where fv = volume fraction (-)
+ *									  rho = material density (kg/m^3)
+ *									  cp = heat capacity of the material (J/kg/K)
+ *									  K = thermal conductivity (W/m/K)
+ *									  T = temperature (K)
+ *
+ *			The tables are loaded once, and each element is evaluated in a batch over all
+ *			of its quadrature points (see ThermalPropertyTable). The derivatives
+ *			d(rho_cp_eps)/dT and d(k_eps)/dT are declared as material property derivatives,
+ *			which the kernels add to their Jacobians when T is their own variable.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This material was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "Material.h"
+#include "DerivativeMaterialInterface.h"
+#include "ThermalPropertyTable.h"
+
+/// TabulatedThermalFluidProperties class object inherits from Material object
+/** This class object inherits from the Material object in the MOOSE framework.
+
+    Produces the same properties as ThermalFluidProperties, but from tables of
+    rho(T), cp(T), and K(T), together with their temperature derivatives. */
+class TabulatedThermalFluidProperties : public DerivativeMaterialInterface<Material>
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  TabulatedThermalFluidProperties(const InputParameters & parameters);
+
+protected:
+  /// Evaluates all quadrature points of the element in one batch
+  virtual void computeProperties() override;
+
+  /// Evaluates a single quadrature point (used when properties are computed point by point)
+  virtual void computeQpProperties() override;
+
+  const VariableValue & _temperature; ///< Coupled temperature variable (K)
+  const VariableValue & _volfrac;     ///< Variable for volume fraction (-)
+
+  ThermalPropertyTable _table; ///< Tables of the properties against temperature
+  unsigned int _density_prop;  ///< Index of the density table
+  unsigned int _heat_cap_prop; ///< Index of the heat capacity table
+  unsigned int _cond_prop;     ///< Index of the thermal conductivity table
+
+  MaterialProperty<Real> & _rho_cp_eps;     ///< Material property for fv * rho * cp (J/m^3/K)
+  MaterialProperty<Real> & _k_eps;          ///< Material property for fv * K (W/m/K)
+  MaterialProperty<Real> & _drho_cp_eps_dT; ///< d(fv * rho * cp)/dT (J/m^3/K^2)
+  MaterialProperty<Real> & _dk_eps_dT;      ///< d(fv * K)/dT (W/m/K^2)
+
+  ThermalPropertyTable::Location _loc; ///< Location of the quadrature points in the table
+  std::vector<Real> _qp_T;             ///< Temperature at the quadrature points
+  std::vector<Real> _qp_rho;           ///< Density at the quadrature points
+  std::vector<Real> _qp_drho;          ///< Density derivative at the quadrature points
+  std::vector<Real> _qp_cp;            ///< Heat capacity at the quadrature points
+  std::vector<Real> _qp_dcp;           ///< Heat capacity derivative at the quadrature points
+  std::vector<Real> _qp_k;             ///< Conductivity at the quadrature points
+  std::vector<Real> _qp_dk;            ///< Conductivity derivative at the quadrature points
+};
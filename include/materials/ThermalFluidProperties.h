@@ -0,0 +1,57 @@
+/*!
+ *  \file ThermalFluidProperties.h
+ *	\brief Material object for the lumped thermal coefficients used by the teal kernels
+ *	\details This file creates a material object that evaluates the lumped thermal
+ *				coefficients of a phase once per quadrature point:
+ *						rho_cp_eps = fv * rho * cp
+ *						k_eps = fv * K
+ *								where fv = volume fraction (-)
+ *									  rho = material density (kg/m^3)
+ *									  cp = heat capacity of the material (J/kg/K)
+ *									  K = thermal conductivity (W/m/K)
+ *
+ *			The kernels consume these through their 'rho_cp_eps' and 'k_eps' parameters
+ *			instead of interpolating the individual property variables themselves.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This material was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "Material.h"
+
+/// ThermalFluidProperties class object inherits from Material object
+/** This class object inherits from the Material object in the MOOSE framework.
+
+    Each of the inputs may either be a coupled variable or a constant. When all of
+    the inputs are constants the products are formed once at construction and the
+    material only copies them into the property storage (use 'constant_on = SUBDOMAIN'
+    to also skip the per-qp copies). */
+class ThermalFluidProperties : public Material
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ThermalFluidProperties(const InputParameters & parameters);
+
+protected:
+  /// Required function override for Material objects in MOOSE
+  virtual void computeQpProperties() override;
+
+  const VariableValue & _density;      ///< Coupled material density variable (kg/m^3)
+  const VariableValue & _heat_cap;     ///< Coupled material heat capacity variable (J/kg/K)
+  const VariableValue & _conductivity; ///< Thermal Conductivity variable (W/m/K)
+  const VariableValue & _volfrac;      ///< Variable for volume fraction (-)
+
+  /// True if none of the inputs are coupled to variables
+  const bool _constant;
+  Real _rho_cp_eps_const; ///< Constant value of fv * rho * cp (J/m^3/K)
+  Real _k_eps_const;      ///< Constant value of fv * K (W/m/K)
+
+  MaterialProperty<Real> & _rho_cp_eps; ///< Material property for fv * rho * cp (J/m^3/K)
+  MaterialProperty<Real> & _k_eps;      ///< Material property for fv * K (W/m/K)
+};
@@ -0,0 +1,46 @@
+/*!
+ *  \file ChannelBundleMeshGenerator.h
+ *	\brief Mesh generator for a bundle of independent 1D flow channels
+ *	\details This file creates a mesh generator that builds a set of parallel, disconnected
+ *			channels of EDGE2 elements along the x-axis. Each channel is offset in y by
+ *			the channel spacing, shares no nodes with the other channels, and is numbered
+ *			contiguously (nodes and elements) so that the degrees of freedom of each channel
+ *			form a tridiagonal block of the system matrix.
+ *
+ *			The first node of every channel is placed on the "inlet" boundary and the last
+ *			node on the "outlet" boundary (side and node sets). The channels may optionally
+ *			be placed on their own subdomains (channel_0, channel_1, ...).
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This mesh generator was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "MeshGenerator.h"
+
+/// ChannelBundleMeshGenerator class object inherits from MeshGenerator object
+/** This class object inherits from the MeshGenerator object in the MOOSE framework.
+
+    Builds num_channels independent channels with nx EDGE2 elements each. */
+class ChannelBundleMeshGenerator : public MeshGenerator
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ChannelBundleMeshGenerator(const InputParameters & parameters);
+
+  /// Builds the channel bundle
+  std::unique_ptr<MeshBase> generate() override;
+
+protected:
+  const unsigned int _num_channels; ///< Number of channels in the bundle
+  const unsigned int _nx;           ///< Number of elements along each channel
+  const Real _xmin;                 ///< Inlet x-coordinate of every channel (m)
+  const Real _xmax;                 ///< Outlet x-coordinate of every channel (m)
+  const Real _spacing;              ///< Distance between neighboring channels in y (m)
+  const bool _block_per_channel;    ///< True if each channel is placed on its own subdomain
+};
@@ -0,0 +1,91 @@
+/*!
+ *  \file TealStreamOutput.h
+ *  \brief Output object that streams selected scalar quantities to an append-only CSV file
+ *  \details This file creates an output object for long transients, where writing full
+ *            Exodus files every step costs more than the solve. Only the selected
+ *            postprocessors (e.g., ThermalFrontPosition, phase averaged temperatures) and
+ *            Real reporter values (e.g., the boundary energy rates of ThermalFluidEnergyFlow)
+ *            are written, one row per output time, to '<file_base>_stream.csv'.
+ *
+ *            The rows are formatted by the output and, with 'asynchronous = true', written
+ *            by a background thread of the first processor, so the solve does not wait on
+ *            the file system. The file is flushed every 'flush_interval' rows. At the end of
+ *            the run (on EXEC_FINAL) the queued rows are written, the writer thread is stopped
+ *            and the file is flushed. When a run is recovered the file is continued: the rows
+ *            written after the checkpoint, at or after the time of the first new row, are
+ *            dropped before the new rows are appended, so no row appears twice.
+ *
+ *  \note For restarts, use this together with the Checkpoint output, which writes one
+ *          restart file per processor. Full fields can still be written to Exodus at a
+ *          coarse 'time_step_interval'.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This output was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "FileOutput.h"
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+/// TealStreamOutput class object inherits from FileOutput object
+/** Appends the selected postprocessor and reporter values to a CSV file. */
+class TealStreamOutput : public FileOutput
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  TealStreamOutput(const InputParameters & parameters);
+
+  /// Writes the remaining rows and stops the writer thread, if not done at the end of the run
+  virtual ~TealStreamOutput();
+
+  /// Checks the selected values, and opens the file and writer thread
+  virtual void initialSetup() override;
+
+  /// Name of the streamed file
+  virtual std::string filename() override;
+
+  /// Outputs as usual, and writes the remaining rows at the end of the run (EXEC_FINAL)
+  virtual void outputStep(const ExecFlagType & type) override;
+
+protected:
+  /// Formats the row of the current time and hands it to the writer
+  virtual void output() override;
+
+  /// Writes a row, directly or through the writer thread
+  void writeRow(std::string row);
+
+  /// Loop of the writer thread
+  void writerLoop();
+
+  /// Drops the rows of a recovered file at or after the given time, and opens it to append
+  void truncateRecoveredRows(Real time);
+
+  /// Writes the queued rows, stops the writer thread and flushes the file (once)
+  void finish();
+
+  const std::vector<PostprocessorName> & _pp_names;  ///< Postprocessors to stream
+  const std::vector<ReporterName> & _reporter_names; ///< Real reporter values to stream
+  const unsigned int _precision;                     ///< Significant digits of the values
+  const unsigned int _flush_interval;                ///< Rows written between flushes
+  const bool _asynchronous;                          ///< Whether a thread does the writes
+
+  std::ofstream _file;          ///< Streamed file (open on the first processor only)
+  unsigned int _unflushed_rows; ///< Rows written since the last flush
+  bool _truncate_on_output;     ///< Whether a recovered file still has to be truncated
+
+  std::thread _writer;                ///< Writer thread
+  std::mutex _mutex;                  ///< Protects the queue and the stop flag
+  std::condition_variable _condition; ///< Wakes the writer thread
+  std::deque<std::string> _queue;     ///< Rows waiting to be written
+  bool _stop;                         ///< Whether the writer thread should stop
+};
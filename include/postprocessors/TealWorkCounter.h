@@ -0,0 +1,50 @@
+/*!
+ *  \file TealWorkCounter.h
+ *  \brief Postprocessor reporting the work counters of a profiled teal kernel or BC
+ *  \details This file creates a postprocessor that reports one of the work counters
+ *            (residual/Jacobian evaluations, upwind/downwind nodes) kept by a teal
+ *            kernel or integrated boundary condition that was given 'profile = true'.
+ *            The counters of all thread copies of the object and all processors are
+ *            summed, and are cumulative over the run.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This postprocessor was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+#include "TealProfilingInterface.h"
+
+/// TealWorkCounter class object inherits from GeneralPostprocessor object
+/** Sums a work counter of a profiled kernel or BC over threads and processors. */
+class TealWorkCounter : public GeneralPostprocessor
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  TealWorkCounter(const InputParameters & parameters);
+
+  /// Checks that the object exists and is profiled
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() const override;
+
+protected:
+  /// Returns the profiled thread copy of the object (or nullptr if it does not exist)
+  const TealProfilingInterface * getProfiledObject(THREAD_ID tid) const;
+
+  /// Name of the kernel or integrated BC to report
+  const std::string & _object_name;
+
+  /// Counter to report
+  const TealProfilingInterface::Counter _counter;
+
+  /// Summed counter value
+  Real _value;
+};
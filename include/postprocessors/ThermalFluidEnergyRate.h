@@ -0,0 +1,36 @@
+/*!
+ *  \file ThermalFluidEnergyRate.h
+ *  \brief Postprocessor reporting one energy rate of a ThermalFluidEnergyFlow reporter
+ *  \details This file creates a postprocessor that returns one of the energy rates (W)
+ *            published by a ThermalFluidEnergyFlow reporter, e.g. 'energy/net_outflow'.
+ *            As a postprocessor the rate can be summed over time steps and combined with
+ *            other postprocessors, e.g. to check the energy balance of a simulation.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This postprocessor was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+/// ThermalFluidEnergyRate class object inherits from GeneralPostprocessor object
+/** Returns an energy rate of a ThermalFluidEnergyFlow reporter. */
+class ThermalFluidEnergyRate : public GeneralPostprocessor
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ThermalFluidEnergyRate(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual PostprocessorValue getValue() const override;
+
+protected:
+  /// Energy rate published by the ThermalFluidEnergyFlow reporter (W)
+  const Real & _rate;
+};
@@ -0,0 +1,73 @@
+/*!
+ *  \file ThermalFluidStableDT.h
+ *  \brief Postprocessor for the largest stable time step of a thermal fluid problem
+ *  \details This file creates a postprocessor that evaluates, at each quadrature point of
+ *            each element, the time step limits of advection and conduction from the same
+ *            velocity and property inputs as the teal kernels:
+ *                  dt_adv = Co * h / |v|
+ *                  dt_cond = Fo * h^2 * rho * cp * fv / (K * fv)
+ *                          where Co = largest Courant number (-)
+ *                          Fo = largest Fourier number (-)
+ *                          h = smallest edge length of the element (m)
+ *                          v = velocity (m/s)
+ *
+ *            The value is the smallest limit over the mesh, so that it can be given to a
+ *            PostprocessorDT time stepper (or as 'cfl_time_scale' of PseudoTransientDT with
+ *            'limit = advection' and 'courant = 1'). The element that sets the limit is
+ *            found over all processors; with 'output' it may be reported in place of the
+ *            time step (its id, Courant number at the current dt, or cell Peclet number
+ *            Pe = |v| h / alpha), and with 'verbose = true' it is written to the console.
+ *
+ *            With no velocity and no conduction no element limits the time step. The value
+ *            is then 'no_limit_dt' if given, and otherwise reporting the time step is an error.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This postprocessor was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "ElementPostprocessor.h"
+#include "TealThermalPropertiesInterface.h"
+
+/// ThermalFluidStableDT class object inherits from ElementPostprocessor object
+/** Smallest advective or conductive time step limit over the mesh. */
+class ThermalFluidStableDT : public TealThermalPropertiesInterface<ElementPostprocessor>
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ThermalFluidStableDT(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() const override;
+
+protected:
+  const VariableValue & _ux; ///< Velocity in the x-direction (m/s)
+  const VariableValue & _uy; ///< Velocity in the y-direction (m/s)
+  const VariableValue & _uz; ///< Velocity in the z-direction (m/s)
+
+  const Real _courant; ///< Largest Courant number (-)
+  const Real _fourier; ///< Largest Fourier number (-)
+
+  /// Limits included in the time step
+  const enum class Limit { both, advection, diffusion } _limit;
+  /// Quantity reported as the value of the postprocessor
+  const enum class Output { dt, element_id, courant, peclet } _output;
+  const bool _verbose; ///< True to write the limiting element to the console
+  /// Time step reported when no element limits it, only valid if the parameter is given
+  const Real _no_limit_dt;
+
+  Real _dt_min;             ///< Smallest time step limit (s)
+  dof_id_type _limit_elem;  ///< Id of the element with the smallest limit
+  Real _limit_speed;        ///< Velocity magnitude at the limit (m/s)
+  Real _limit_h;            ///< Element size at the limit (m)
+  Real _limit_diffusivity;  ///< Thermal diffusivity at the limit (m^2/s)
+  bool _limit_is_advection; ///< True if advection sets the limit
+};
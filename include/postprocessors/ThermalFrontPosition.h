@@ -0,0 +1,55 @@
+/*!
+ *  \file ThermalFrontPosition.h
+ *  \brief Postprocessor for the position of a thermal front along a coordinate direction
+ *  \details This file creates a postprocessor that reports how far a thermal front has
+ *            advanced along the x, y, or z direction. The region behind the front is where
+ *            the temperature is above the threshold (a 'hot' front) or below it (a 'cold'
+ *            front), and the front position is the largest coordinate of a quadrature point
+ *            in that region:
+ *                  x_front = max { x_qp : T_qp >= T_threshold }   (hot front)
+ *
+ *            The front is assumed to advance in the positive direction, unless 'reverse' is
+ *            set, in which case the smallest coordinate is reported. Before the front enters
+ *            the domain, the upstream end of the domain is reported. The resolution is the
+ *            spacing of the quadrature points.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This postprocessor was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "ElementPostprocessor.h"
+
+/// ThermalFrontPosition class object inherits from ElementPostprocessor object
+/** Furthest coordinate that the temperature on one side of a threshold has reached. */
+class ThermalFrontPosition : public ElementPostprocessor
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ThermalFrontPosition(const InputParameters & parameters);
+
+  /// Finds the upstream end of the domain
+  virtual void initialSetup() override;
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() const override;
+
+protected:
+  const VariableValue & _temperature; ///< Temperature variable (K)
+  const Real _threshold;              ///< Temperature that marks the front (K)
+  const bool _hot;                    ///< True if the region behind the front is hotter
+  const unsigned int _component;      ///< Coordinate direction of the front (0, 1, or 2)
+  const Real _sign;                   ///< 1 if the front advances in the positive direction
+
+  Real _upstream; ///< Position reported before the front enters the domain
+  Real _furthest; ///< Furthest signed coordinate of the region behind the front
+  bool _found;    ///< True if any quadrature point is behind the front
+};
@@ -0,0 +1,52 @@
+/*!
+ *  \file ThermalFluidEnergyFlow.h
+ *  \brief Reporter for the energy rates across the boundaries of a ThermalFluidFluxBC
+ *  \details This file creates a reporter that publishes the inflow and outflow energy
+ *            rates that a ThermalFluidFluxBC with 'energy_flow = true' sums while it
+ *            assembles its residual. The rates of all thread copies of the BC and all
+ *            processors are summed for each requested boundary, and reported as
+ *            '<boundary>_inflow' and '<boundary>_outflow' (W), together with the total
+ *            'net_outflow' (W) of the requested boundaries.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This reporter was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "GeneralReporter.h"
+
+class ThermalFluidFluxBC;
+
+/// ThermalFluidEnergyFlow class object inherits from GeneralReporter object
+/** Sums the boundary energy rates of a ThermalFluidFluxBC over threads and processors. */
+class ThermalFluidEnergyFlow : public GeneralReporter
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ThermalFluidEnergyFlow(const InputParameters & parameters);
+
+  /// Checks that the BC exists and sums the energy rates
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+
+protected:
+  /// Returns the thread copy of the BC (or nullptr if it is not a ThermalFluidFluxBC)
+  const ThermalFluidFluxBC * getFluxBC(THREAD_ID tid) const;
+
+  /// Name of the ThermalFluidFluxBC to report
+  const std::string & _bc_name;
+
+  /// Boundaries to report
+  std::vector<BoundaryID> _boundary_ids;
+
+  std::vector<Real *> _inflow;  ///< Inflow energy rate of each boundary (W)
+  std::vector<Real *> _outflow; ///< Outflow energy rate of each boundary (W)
+  Real & _net_outflow;          ///< Total outflow minus inflow of all boundaries (W)
+};
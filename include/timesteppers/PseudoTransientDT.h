@@ -0,0 +1,70 @@
+/*!
+ *  \file PseudoTransientDT.h
+ *	\brief Time stepper for pseudo transient continuation to a steady state
+ *	\details This file creates a time stepper for problems where only the steady
+ *				solution is of interest (e.g., HeatAdvectionConservative with
+ *				ThermalFluidFluxBC). The time step grows by switched evolution
+ *				relaxation (SER) as the steady residual is reduced:
+ *						dt_n+1 = dt_n * (R_n-1 / R_n)^p
+ *								where R_n = steady residual norm at step n
+ *									  p = 'ser_exponent' (-)
+ *
+ *			The residual is read from a postprocessor, normally a Residual postprocessor
+ *			with 'residual_type = INITIAL_BEFORE_PRESET'. With implicit Euler the initial
+ *			residual of each step is the steady residual of the previous solution, because
+ *			the time derivative is zero before the first Newton iteration.
+ *
+ *			When 'cfl_time_scale' is given (the time for the flow to cross one element,
+ *			e.g. h / |v|), the SER update is applied to the Courant number instead, and
+ *			dt = CFL * time scale stays aware of the advection while it grows from
+ *			'initial_cfl' up to 'max_cfl'. The growth per step is bounded by 'max_growth'
+ *			and 'min_growth', and the Executioner's 'dtmin'/'dtmax' still apply. Combine
+ *			the stepper with 'steady_state_detection' to end the run once steady.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This time stepper was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "TimeStepper.h"
+
+/// PseudoTransientDT class object inherits from TimeStepper object
+/** This class object inherits from the TimeStepper object in the MOOSE framework. */
+class PseudoTransientDT : public TimeStepper
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  PseudoTransientDT(const InputParameters & parameters);
+
+protected:
+  /// Time step of the first step
+  virtual Real computeInitialDT() override;
+
+  /// Time step of all following steps, from the reduction of the steady residual
+  virtual Real computeDT() override;
+
+  /// Returns CFL * time scale, checked to be positive and finite
+  Real cflDT() const;
+
+  /// Returns the SER growth factor of the time step (and stores the residual for the next step)
+  Real serGrowth();
+
+  const PostprocessorValue & _residual; ///< Steady residual norm (from a postprocessor)
+  const bool _use_cfl;                  ///< True if the steps follow the advective time scale
+  /// Time for the flow to cross one element (s), only valid if _use_cfl
+  const PostprocessorValue * const _cfl_time_scale;
+  const Real _initial_dt;   ///< Time step of the first step without CFL (s)
+  const Real _initial_cfl;  ///< Courant number of the first step (-)
+  const Real _max_cfl;      ///< Largest Courant number (-)
+  const Real _ser_exponent; ///< Exponent of the SER update (-)
+  const Real _max_growth;   ///< Largest growth of the time step per step (-)
+  const Real _min_growth;   ///< Smallest growth of the time step per step (-)
+
+  Real & _residual_old; ///< Steady residual norm of the previous step (negative before one)
+  Real & _cfl;          ///< Current Courant number (-)
+};
@@ -0,0 +1,90 @@
+/*!
+ *  \file LinearJacobianReuse.h
+ *  \brief User object that reuses the Jacobian and preconditioner of linear problems
+ *  \details This file creates a user object that lags the Jacobian and preconditioner of
+ *            the nonlinear solver across time steps. When every kernel and BC is linear
+ *            in the nonlinear variables and the properties are auxiliary variables, the
+ *            Jacobian depends only on dt and the properties. This object then asks PETSc
+ *            to assemble and factor the Jacobian once, and to reuse the factors in every
+ *            later step. They are rebuilt at the next step whenever dt changes, a property
+ *            variable changes, or the mesh changes. Only implicit Euler is supported, since
+ *            other schemes (e.g. BDF2) change the time derivative coefficient du_dot_du
+ *            between steps of the same dt.
+ *
+ *            The kernels and integrated BCs of the nonlinear system are checked when the
+ *            simulation starts. Every object must be of a type that is linear for fixed
+ *            coupled variables, take no material properties, and couple other nonlinear
+ *            variables only as 'coupled_temperature'. The auxiliary variables that the
+ *            objects couple are the properties that are monitored. The check can be
+ *            turned off with 'check_linearity = false', in which case the user asserts
+ *            that the problem is linear. Other variables to monitor (e.g., those used by
+ *            functions or materials) are given in 'properties'.
+ *
+ *  \note Nodal BCs, Dirac kernels, and constraints are not checked.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This user object was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+#include <set>
+
+class MooseObject;
+class Coupleable;
+
+/// LinearJacobianReuse class object inherits from GeneralUserObject object
+/** Lags the SNES Jacobian and preconditioner until dt or the properties change. */
+class LinearJacobianReuse : public GeneralUserObject
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  LinearJacobianReuse(const InputParameters & parameters);
+
+  /// Checks the linearity of the nonlinear system and collects the properties
+  virtual void initialSetup() override;
+
+  /// Forces a new Jacobian after the mesh changes
+  virtual void meshChanged() override;
+
+  virtual void initialize() override {}
+
+  /// Decides (at the start of each step) whether the Jacobian is rebuilt or reused
+  virtual void execute() override;
+
+  virtual void finalize() override {}
+
+  /// Number of times the Jacobian has been rebuilt
+  unsigned int numRebuilds() const { return _num_rebuilds; }
+
+protected:
+  /// Adds the auxiliary variables of an object to the properties, and checks it is linear
+  void checkObject(const MooseObject & object, const Coupleable & coupleable);
+
+  /// Collects the local dofs of the property variables
+  void collectPropertyDofs();
+
+  /// Copies the current values of the property variables
+  void storeProperties();
+
+  /// Returns true if a property variable has changed since the last rebuild (on any rank)
+  bool propertiesChanged() const;
+
+  const bool _check_linearity; ///< Whether to check that every object is linear
+  const Real _tolerance;       ///< Relative change of a property that forces a rebuild
+  const bool _verbose;         ///< Whether to print when the Jacobian is rebuilt
+
+  std::set<unsigned int> _property_vars;   ///< Auxiliary variable numbers of the properties
+  std::vector<dof_id_type> _property_dofs; ///< Local dofs of the property variables
+  std::vector<Real> _property_values;      ///< Property values at the last rebuild
+
+  bool _rebuild;              ///< Whether the next step must rebuild the Jacobian
+  Real _rebuild_dt;           ///< Time step of the last rebuild (s)
+  unsigned int _num_rebuilds; ///< Number of rebuilds so far
+};
@@ -0,0 +1,29 @@
+/*!
+ *  \file TealArrayParameters.h
+ *	\brief Per component coefficients of the array variable kernels
+ *	\details This file creates a small utility that the array variable kernels use to
+ *				read their per component properties. A property is given as a list with
+ *				either one value (used for all components) or one value per component of
+ *				the array variable, and is returned as an Eigen vector so that the kernels
+ *				can form the products of the properties once, at construction.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This utility was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "MooseTypes.h"
+
+class MooseObject;
+
+namespace TealArrayParameters
+{
+/// Returns the std::vector<Real> parameter 'name' of the object as one value per component
+/** A single value is broadcast to all components, any size other than 1 or 'count' is a
+  parameter error. */
+RealEigenVector componentValues(const MooseObject & object,
+                                const std::string & name,
+                                const unsigned int count);
+}
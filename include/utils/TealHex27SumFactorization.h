@@ -0,0 +1,91 @@
+/*!
+ *  \file TealHex27SumFactorization.h
+ *	\brief Sum factorization of the second order Lagrange basis on HEX27 elements
+ *	\details This file provides the tensor product operations used by the sum factorized
+ *			kernels. On a HEX27 element the second order Lagrange shape functions are
+ *			products of three 1D quadratic functions, and a 3 x 3 x 3 Gauss rule is a
+ *			product of three 1D rules. The values and reference gradients of a field at all
+ *			27 quadrature points are then found by applying a 3 x 3 matrix (the 1D basis
+ *			values B or derivatives D at the 1D points) along one direction at a time,
+ *			instead of summing all 27 shape functions at each of the 27 points. The
+ *			integration of quadrature point values against all test functions uses the
+ *			transposed matrices in the same way.
+ *
+ *			Each sweep along one direction costs 81 multiplications, so the values take 3
+ *			sweeps (243 multiplications, in place of 729 for the direct sums) and the three
+ *			reference gradients 8 sweeps (648 in place of 2187). At second order the saving
+ *			is modest, and the sweeps do not remove the shape function evaluation of libMesh,
+ *			which still fills phi and grad_phi for every element.
+ *
+ *			The 1D tables and the node and quadrature point orderings are built from the
+ *			quadrature rule, and checked against the test functions of the element, once per
+ *			object. Tensors are stored with the first reference direction fastest.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This utility was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <array>
+
+namespace libMesh
+{
+class QBase;
+}
+
+/// TealHex27SumFactorization class object
+/** Holds the 1D tables of the 3 x 3 x 3 Gauss rule and applies the tensor product sweeps of
+    the second order Lagrange basis on HEX27 elements. */
+class TealHex27SumFactorization
+{
+public:
+  /// Values at the 27 nodes or 27 quadrature points, in tensor order
+  typedef std::array<Real, 27> Tensor;
+
+  /// Builds the tables from qrule and checks them against the test functions (false on mismatch)
+  bool init(const libMesh::QBase & qrule, const VariableTestValue & test);
+
+  /// True once init() has succeeded
+  bool initialized() const { return _initialized; }
+
+  /// libMesh node (and Lagrange dof) of tensor entry t
+  unsigned int node(const unsigned int t) const { return _node[t]; }
+
+  /// libMesh quadrature point of tensor entry t
+  unsigned int qp(const unsigned int t) const { return _qp[t]; }
+
+  /// Values at the quadrature points of the nodal values
+  void interpolate(const Tensor & nodal, Tensor & values) const;
+
+  /// Reference gradients at the quadrature points of the nodal values
+  void gradients(const Tensor & nodal, std::array<Tensor, 3> & ref_grad) const;
+
+  /// Adds the integrals of the quadrature point values against each test function to nodal
+  void integrate(const Tensor & values, Tensor & nodal) const;
+
+  /// Adds the integrals of the quadrature point vectors against each reference test gradient
+  void integrateGradients(const std::array<Tensor, 3> & gradients, Tensor & nodal) const;
+
+private:
+  /// 3 x 3 matrix of a 1D table, indexed [row][column]
+  typedef std::array<std::array<Real, 3>, 3> Matrix;
+
+  /// Applies m along direction dir of in: out_k = sum_l m[k][l] in_l
+  static void sweep(const Matrix & m, const unsigned int dir, const Tensor & in, Tensor & out);
+  /// Adds m applied along direction dir of in to out
+  static void sweepAdd(const Matrix & m, const unsigned int dir, const Tensor & in, Tensor & out);
+
+  bool _initialized = false; ///< True once the tables are built and checked
+
+  Matrix _b;  ///< 1D basis values at the 1D points, [point][basis]
+  Matrix _d;  ///< 1D basis derivatives at the 1D points, [point][basis]
+  Matrix _bt; ///< Transpose of _b, [basis][point]
+  Matrix _dt; ///< Transpose of _d, [basis][point]
+
+  std::array<unsigned int, 27> _node; ///< libMesh node of each tensor entry
+  std::array<unsigned int, 27> _qp;   ///< libMesh quadrature point of each tensor entry
+};
@@ -0,0 +1,129 @@
+/*!
+ *  \file TealSaveIn.h
+ *	\brief Thread local accumulation of element contributions into save_in variables
+ *	\details This file provides the save_in and diag_save_in additions of the teal kernels
+ *			and boundary conditions that assemble their own element residuals and Jacobians.
+ *			Each thread copy of an object appends its element contributions (dof indices and
+ *			values) to its own buffer, without any lock. The copies share a count of the
+ *			elements (or sides) assembled in the current loop. The thread that assembles the
+ *			last one adds the buffers of all threads to the auxiliary solution, taking the
+ *			global Threads::spin_mtx once per assembly loop instead of once per element. The
+ *			lock is still needed for that one addition, since MOOSE objects add their save_in
+ *			contributions to the same auxiliary solution under it.
+ *
+ *			The expected count is the number of active local elements of the kernel's blocks,
+ *			or of active local sides of the boundary condition's boundaries, and is found in
+ *			residualSetup() and jacobianSetup(). Contributions of a loop that is interrupted
+ *			(e.g., by a MooseException) are dropped at the next setup, since MOOSE zeroes the
+ *			save_in variables before every loop.
+ *
+ *			The buffers hold one entry per element dof and save_in variable, and keep their
+ *			capacity between loops.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This utility was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseVariableFE.h"
+
+#include "libmesh/dense_matrix.h"
+#include "libmesh/dense_vector.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+class BlockRestrictable;
+class BoundaryRestrictable;
+class IntegratedBCBase;
+class KernelBase;
+class MooseMesh;
+class MooseObject;
+
+/// TealSaveIn class object
+/** Buffers the save_in and diag_save_in contributions of one thread copy of a teal object, and
+    adds the buffers of all threads to the auxiliary solution once per assembly loop. */
+class TealSaveIn
+{
+public:
+  /// Constructor for a kernel, which is called once per active local element of its blocks
+  TealSaveIn(const KernelBase & kernel,
+             MooseMesh & mesh,
+             const THREAD_ID tid,
+             const std::vector<MooseVariableFEBase *> & save_in,
+             const std::vector<MooseVariableFEBase *> & diag_save_in);
+
+  /// Constructor for an integrated BC, which is called once per active local side of its boundaries
+  TealSaveIn(const IntegratedBCBase & bc,
+             MooseMesh & mesh,
+             const THREAD_ID tid,
+             const std::vector<MooseVariableFEBase *> & save_in,
+             const std::vector<MooseVariableFEBase *> & diag_save_in);
+
+  /// Starts a residual loop, must be called from residualSetup() of the object
+  void residualSetup();
+
+  /// Starts a Jacobian loop, must be called from jacobianSetup() of the object
+  void jacobianSetup();
+
+  /// Adds an element residual to each save_in variable
+  void addResidual(const DenseVector<Number> & local_re);
+
+  /// Adds the diagonal of an element Jacobian to each diag_save_in variable
+  void addDiagJacobian(const DenseMatrix<Number> & local_ke);
+
+private:
+  /// Contributions of one thread to one save_in variable
+  struct Contributions
+  {
+    std::vector<numeric_index_type> dofs; ///< Dof indices of the save_in variable
+    std::vector<Number> values;           ///< Value added at each dof index
+  };
+
+  /// State of one kind of assembly loop, shared by all thread copies of the object
+  struct Loop
+  {
+    std::vector<std::vector<Contributions>> buffers; ///< Contributions of each thread
+    std::atomic<std::size_t> calls{0};               ///< Elements assembled in this loop
+    std::size_t expected_calls = 0;                  ///< Elements assembled by the whole loop
+  };
+
+  /// State of the residual and Jacobian loops of one object
+  struct Shared
+  {
+    Loop residual; ///< Residual loops (save_in)
+    Loop jacobian; ///< Jacobian loops (diag_save_in)
+  };
+
+  /// Clears this thread's buffer, and (on thread 0) restarts the count of the loop
+  void setup(Loop & loop, const std::vector<MooseVariableFEBase *> & vars);
+
+  /// Buffers one element contribution, and adds all buffers after the last element of the loop
+  void add(Loop & loop, const std::vector<MooseVariableFEBase *> & vars, const Number * values);
+
+  /// Adds the buffers of all threads to the auxiliary solution and clears them
+  void flush(Loop & loop, const std::vector<MooseVariableFEBase *> & vars);
+
+  /// Number of elements (or sides) the object is called on in one assembly loop
+  std::size_t expectedCalls() const;
+
+  /// State shared by the thread copies of an object (nullptr if it has no save_in variables)
+  static std::shared_ptr<Shared> sharedState(const MooseObject & object,
+                                             const MooseMesh & mesh,
+                                             const bool has_save_in);
+
+  const BlockRestrictable * const _blocks;        ///< Blocks of a kernel (nullptr for a BC)
+  const BoundaryRestrictable * const _boundaries; ///< Boundaries of a BC (nullptr for a kernel)
+  MooseMesh & _mesh;                              ///< Mesh the object is assembled on
+  const THREAD_ID _tid;                           ///< Thread of this copy of the object
+  /// save_in variables of the object
+  const std::vector<MooseVariableFEBase *> & _save_in;
+  /// diag_save_in variables of the object
+  const std::vector<MooseVariableFEBase *> & _diag_save_in;
+  const std::shared_ptr<Shared> _shared; ///< State shared by the thread copies
+  std::vector<Number> _diag;             ///< Diagonal of the current element Jacobian
+};
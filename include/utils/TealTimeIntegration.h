@@ -0,0 +1,25 @@
+/*!
+ *  \file TealTimeIntegration.h
+ *	\brief Checks of the time integration scheme for kernels that tag all terms as time terms
+ *	\details This file provides the check used by the teal kernels that derive from TimeKernel
+ *			but also assemble steady terms (conduction, advection, exchange) in the same element
+ *			loop. All of their contributions land in the time residual tag, which only gives
+ *			the correct residual for schemes that add the time and non-time residuals with the
+ *			same weight (ImplicitEuler and BDF2). Other schemes (e.g. Crank-Nicolson or the
+ *			explicit schemes) weight the time tag differently, so the kernels reject them.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This utility was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+class MooseObject;
+class SystemBase;
+
+namespace TealTimeIntegration
+{
+/// Errors (for object) unless every time integrator of sys is ImplicitEuler or BDF2
+void checkAllTermsTimeTagged(const MooseObject & object, SystemBase & sys);
+}
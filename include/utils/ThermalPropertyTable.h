@@ -0,0 +1,79 @@
+/*!
+ *  \file ThermalPropertyTable.h
+ *	\brief Tabulated property of temperature with batch interpolation
+ *	\details This file creates a small utility for evaluating a property tabulated
+ *				against temperature, y(T), and its derivative dy/dT. The table is either
+ *				piecewise linear or a monotone (Fritsch-Carlson) cubic Hermite spline,
+ *				and is held constant outside of the tabulated range (zero derivative).
+ *
+ *			Evaluation is split in two passes so that several properties tabulated on
+ *			the same temperatures share the search: locate() finds the interval of
+ *			each point once (O(1) for uniformly spaced temperatures, binary search
+ *			otherwise), and interpolate() then evaluates a table for all the points
+ *			in a single contiguous loop that the compiler can vectorize.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This utility was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <vector>
+
+/// ThermalPropertyTable class object
+/** Holds the temperature grid and the values (and spline slopes) of one or more properties. */
+class ThermalPropertyTable
+{
+public:
+  /// Type of interpolation between the tabulated points
+  enum class Interpolation
+  {
+    linear,
+    monotone_cubic
+  };
+
+  /// Location of a set of temperatures in the table (filled by locate())
+  struct Location
+  {
+    std::vector<unsigned int> index; ///< Interval of each point (0 to n-2)
+    std::vector<Real> t;             ///< Position of each point within its interval [0, 1]
+    std::vector<Real> h;             ///< Width of the interval of each point
+    std::vector<Real> inv_h;         ///< 1/h inside the table, 0 where the value is clamped
+  };
+
+  /// Builds the table grid (temperatures must be strictly increasing, with at least 2 points)
+  ThermalPropertyTable(const std::vector<Real> & temperatures, Interpolation interpolation);
+
+  /// Adds a tabulated property (same size as the temperatures) and returns its index
+  unsigned int addProperty(const std::vector<Real> & values);
+
+  /// Finds the interval of each of the n temperatures T
+  void locate(const Real * T, const unsigned int n, Location & loc) const;
+
+  /// Evaluates property prop (and dprop/dT) at the n located points
+  void interpolate(const unsigned int prop,
+                   const Location & loc,
+                   const unsigned int n,
+                   Real * value,
+                   Real * deriv) const;
+
+  /// Evaluates property prop (and dprop/dT) at a single temperature
+  void evaluate(const unsigned int prop, const Real T, Real & value, Real & deriv) const;
+
+  /// True if the temperatures are uniformly spaced (O(1) location)
+  bool uniform() const { return _uniform; }
+
+protected:
+  /// Computes the Fritsch-Carlson monotone slopes of a property
+  std::vector<Real> monotoneSlopes(const std::vector<Real> & values) const;
+
+  const std::vector<Real> _temperature;   ///< Tabulated temperatures (K)
+  const Interpolation _interpolation;     ///< Type of interpolation
+  bool _uniform;                          ///< True if the temperatures are uniformly spaced
+  Real _inv_dT;                           ///< 1 / spacing of a uniform table
+  std::vector<std::vector<Real>> _values; ///< Tabulated values of each property
+  std::vector<std::vector<Real>> _slopes; ///< Nodal slopes of each property (cubic only)
+};
@@ -0,0 +1,196 @@
+# Cell-centered finite volume version of kernels/heat_advection
+#
+# Finite volumes conserve the energy exactly: the interior fluxes cancel, and FVHeatConduction
+# adds nothing on the boundaries, so the change of the energy must equal the time integrated
+# net flow through the flux BC
+#
+#     E(t) - E(0) = - sum_steps dt * net_outflow
+#
+# where E = int(rho * cp * T) and net_outflow = rho * cp * ux * H * (T_right - 350), since the
+# flux BC carries the outflow at the boundary face value of T (reported by T_right) and the
+# inflow at the outside temperature.  The run stops with an error if the relative imbalance
+# exceeds the solver tolerance, with either advected interpolation method.
+[Mesh]
+  [./my_mesh]
+        type = GeneratedMeshGenerator
+        dim = 2
+        nx = 50
+        ny = 5
+        xmin = 0
+        xmax = 1
+        ymin = 0
+        ymax = 0.1
+    [../]
+[]
+
+[Variables]
+  [./T]
+        type = MooseVariableFVReal
+        initial_condition = 300 # K
+  [../]
+[]
+
+[AuxVariables]
+  # Parameters for Steel
+  [./rho]
+      type = MooseVariableFVReal
+      initial_condition = 7750  # kg/m^3
+  [../]
+
+  [./cp]
+      type = MooseVariableFVReal
+      initial_condition = 466  # J/kg/K
+  [../]
+
+  [./K]
+      type = MooseVariableFVReal
+      initial_condition = 45   # W/m/K
+  [../]
+
+  [./ux]
+      type = MooseVariableFVReal
+      initial_condition = 0.1   # m/s
+  [../]
+[]
+
+[FVKernels]
+  [./heat_accum]
+    type = FVHeatAccumulation
+    variable = T
+	density = rho
+	heat_capacity = cp
+  [../]
+  [./heat_cond]
+    type = FVHeatConduction
+    variable = T
+	thermal_conductivity = K
+  [../]
+  [./heat_adv]
+    type = FVHeatAdvection
+    variable = T
+	density = rho
+	heat_capacity = cp
+	vel_x = ux
+	advected_interp_method = 'upwind'
+  [../]
+[]
+
+[FVBCs]
+  [./fluxBCs]
+    type = FVThermalFluidFluxBC
+    variable = T
+    boundary = 'left right'
+    density = rho
+	heat_capacity = cp
+	vel_x = ux
+	outside_temperature = 350
+  [../]
+[]
+
+[Postprocessors]
+	[./T_left]
+        type = SideAverageValue
+        boundary = 'left'
+        variable = T
+        execute_on = 'initial timestep_end'
+    [../]
+
+    [./T_right]
+        type = SideAverageValue
+        boundary = 'right'
+        variable = T
+        execute_on = 'initial timestep_end'
+    [../]
+
+	[./T_avg]
+      type = ElementAverageValue
+      variable = T
+      execute_on = 'initial timestep_end'
+  [../]
+
+    [./T_int_0]
+        type = ElementIntegralVariablePostprocessor
+        variable = T
+        execute_on = 'initial'
+    [../]
+
+    [./T_int]
+        type = ElementIntegralVariablePostprocessor
+        variable = T
+        execute_on = 'initial timestep_end'
+    [../]
+
+    # rho * cp * ux * H = 7750 * 466 * 0.1 * 0.1 W/m/K
+    [./net_outflow]
+        type = ParsedPostprocessor
+        expression = '7750 * 466 * 0.1 * 0.1 * (T_right - 350)'
+        pp_names = 'T_right'
+        execute_on = 'timestep_end'
+    [../]
+
+    [./dt]
+        type = TimestepSize
+        execute_on = 'timestep_end'
+    [../]
+
+    [./step_outflow]
+        type = ParsedPostprocessor
+        expression = 'dt * net_outflow'
+        pp_names = 'dt net_outflow'
+        execute_on = 'timestep_end'
+    [../]
+
+    [./total_outflow]
+        type = CumulativeValuePostprocessor
+        postprocessor = step_outflow
+        execute_on = 'timestep_end'
+    [../]
+
+    # rho * cp = 7750 * 466 J/m^3/K
+    [./imbalance]
+        type = ParsedPostprocessor
+        expression = 'abs(7750 * 466 * (T_int - T_int_0) + total_outflow) / (7750 * 466 * T_int_0)'
+        pp_names = 'T_int T_int_0 total_outflow'
+        execute_on = 'timestep_end'
+    [../]
+[]
+
+[UserObjects]
+  [./conserved]
+    type = Terminator
+    expression = 'imbalance > 1e-6'
+    error_level = ERROR
+    message = 'The finite volume thermal fluid objects do not conserve the energy'
+    execute_on = 'timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  solve_type = newton
+
+  start_time = 0.0
+  end_time = 15.0
+  dtmax = 1.0
+
+  [./TimeStepper]
+    type = ConstantDT
+    dt = 1.0
+  [../]
+
+  petsc_options_iname = '-pc_type -pc_factor_shift_type'
+  petsc_options_value = 'lu NONZERO'
+
+  line_search = none
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-8
+  nl_max_its = 10
+  l_tol = 1e-6
+  l_max_its = 300
+[]
+
+[Outputs]
+  print_linear_residuals = true
+  csv = true
+[]
@@ -0,0 +1,296 @@
+# Fluid and two solid phases held in one array variable of temperatures
+#
+# Component 0 is the fluid and components 1 and 2 are the solid phases.  One
+# ArrayHeatAccumulation, one ArrayHeatConduction and one ArrayHeatConvection
+# kernel replace the 3 + 3 + 4 standard kernels (one Variable per phase) of the
+# equivalent two-temperature style input, and assemble all components in the
+# same element loop.  'SMP full = true' adds the coupling between the
+# components from the exchange term.
+#
+# Tf_ref, Ts1_ref and Ts2_ref solve the same problem with the standard kernels.
+# Each component must agree with its reference variable to the solver tolerance,
+# and the run stops with an error if one does not.
+
+[Mesh]
+  [./my_mesh]
+        type = GeneratedMeshGenerator
+        dim = 2
+        nx = 20
+        ny = 5
+        xmin = 0
+        xmax = 1
+        ymin = 0
+        ymax = 0.1
+    [../]
+[]
+
+[Variables]
+  [./T]
+        order = FIRST
+        family = LAGRANGE
+        components = 3
+        initial_condition = '300 300 300' # K
+  [../]
+
+  [./Tf_ref]
+        order = FIRST
+        family = LAGRANGE
+        initial_condition = 300 # K
+  [../]
+  [./Ts1_ref]
+        order = FIRST
+        family = LAGRANGE
+        initial_condition = 300 # K
+  [../]
+  [./Ts2_ref]
+        order = FIRST
+        family = LAGRANGE
+        initial_condition = 300 # K
+  [../]
+[]
+
+[AuxVariables]
+  [./T_fluid]
+      order = FIRST
+      family = LAGRANGE
+  [../]
+  [./T_solid_1]
+      order = FIRST
+      family = LAGRANGE
+  [../]
+  [./T_solid_2]
+      order = FIRST
+      family = LAGRANGE
+  [../]
+[]
+
+[AuxKernels]
+  [./T_fluid]
+    type = ArrayVariableComponent
+    variable = T_fluid
+    array_variable = T
+    component = 0
+  [../]
+  [./T_solid_1]
+    type = ArrayVariableComponent
+    variable = T_solid_1
+    array_variable = T
+    component = 1
+  [../]
+  [./T_solid_2]
+    type = ArrayVariableComponent
+    variable = T_solid_2
+    array_variable = T
+    component = 2
+  [../]
+[]
+
+[Kernels]
+  [./accum]
+    type = ArrayHeatAccumulation
+    variable = T
+	density = '1.2 7750 2200'       # kg/m^3 (air, steel, ceramic)
+	heat_capacity = '1000 466 800'  # J/kg/K
+	volume_frac = '0.4 0.3 0.3'
+  [../]
+  [./cond]
+    type = ArrayHeatConduction
+    variable = T
+	thermal_conductivity = '0.025 45 1.5'  # W/m/K
+	volume_frac = '0.4 0.3 0.3'
+  [../]
+  [./exchange]
+    type = ArrayHeatConvection
+    variable = T
+	fluid_component = 0
+	convection_coeff = 50     # W/m^2/K
+	specific_area = '0 500 250' # m^-1
+	volume_frac = '0.4 0.3 0.3'
+  [../]
+
+  # Reference with one Variable per phase and the standard kernels
+  [./fluid_accum_ref]
+    type = HeatAccumulation
+    variable = Tf_ref
+	density = 1.2
+	heat_capacity = 1000
+	volume_frac = 0.4
+  [../]
+  [./fluid_cond_ref]
+    type = HeatConduction
+    variable = Tf_ref
+	thermal_conductivity = 0.025
+	volume_frac = 0.4
+  [../]
+  [./fluid_conv_1_ref]
+    type = HeatConvection
+    variable = Tf_ref
+	coupled_temperature = Ts1_ref
+	convection_coeff = 50
+	specific_area = 500
+	volume_frac = 0.3
+  [../]
+  [./fluid_conv_2_ref]
+    type = HeatConvection
+    variable = Tf_ref
+	coupled_temperature = Ts2_ref
+	convection_coeff = 50
+	specific_area = 250
+	volume_frac = 0.3
+  [../]
+
+  [./solid_1_accum_ref]
+    type = HeatAccumulation
+    variable = Ts1_ref
+	density = 7750
+	heat_capacity = 466
+	volume_frac = 0.3
+  [../]
+  [./solid_1_cond_ref]
+    type = HeatConduction
+    variable = Ts1_ref
+	thermal_conductivity = 45
+	volume_frac = 0.3
+  [../]
+  [./solid_1_conv_ref]
+    type = HeatConvection
+    variable = Ts1_ref
+	coupled_temperature = Tf_ref
+	convection_coeff = 50
+	specific_area = 500
+	volume_frac = 0.3
+  [../]
+
+  [./solid_2_accum_ref]
+    type = HeatAccumulation
+    variable = Ts2_ref
+	density = 2200
+	heat_capacity = 800
+	volume_frac = 0.3
+  [../]
+  [./solid_2_cond_ref]
+    type = HeatConduction
+    variable = Ts2_ref
+	thermal_conductivity = 1.5
+	volume_frac = 0.3
+  [../]
+  [./solid_2_conv_ref]
+    type = HeatConvection
+    variable = Ts2_ref
+	coupled_temperature = Tf_ref
+	convection_coeff = 50
+	specific_area = 250
+	volume_frac = 0.3
+  [../]
+[]
+
+[BCs]
+  [./inlet]
+    type = ArrayDirichletBC
+    variable = T
+    boundary = 'left'
+    values = '350 300 300'
+  [../]
+
+  [./inlet_fluid_ref]
+    type = DirichletBC
+    variable = Tf_ref
+    boundary = 'left'
+    value = 350
+  [../]
+  [./inlet_solid_1_ref]
+    type = DirichletBC
+    variable = Ts1_ref
+    boundary = 'left'
+    value = 300
+  [../]
+  [./inlet_solid_2_ref]
+    type = DirichletBC
+    variable = Ts2_ref
+    boundary = 'left'
+    value = 300
+  [../]
+[]
+
+[Postprocessors]
+	[./Tf_avg]
+        type = ElementAverageValue
+        variable = T_fluid
+        execute_on = 'initial timestep_end'
+    [../]
+
+	[./Ts2_avg]
+      type = ElementAverageValue
+      variable = T_solid_2
+      execute_on = 'initial timestep_end'
+  [../]
+
+	[./Tf_diff]
+      type = ElementL2Difference
+      variable = T_fluid
+      other_variable = Tf_ref
+      execute_on = 'initial timestep_end'
+  [../]
+
+	[./Ts1_diff]
+      type = ElementL2Difference
+      variable = T_solid_1
+      other_variable = Ts1_ref
+      execute_on = 'initial timestep_end'
+  [../]
+
+	[./Ts2_diff]
+      type = ElementL2Difference
+      variable = T_solid_2
+      other_variable = Ts2_ref
+      execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[UserObjects]
+  [./agree]
+    type = Terminator
+    expression = 'max(Tf_diff, max(Ts1_diff, Ts2_diff)) > 1e-6'
+    error_level = ERROR
+    message = 'The array kernels differ from the standard kernels'
+    execute_on = 'timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type -sub_pc_type -sub_pc_factor_shift_type'
+    petsc_options_value = 'asm lu NONZERO'
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  solve_type = newton
+
+  start_time = 0.0
+  end_time = 10.0
+  dtmax = 1.0
+
+  [./TimeStepper]
+    type = ConstantDT
+    dt = 1.0
+  [../]
+
+  petsc_options = '-snes_converged_reason'
+
+    line_search = none   # none, bt, l2, basic
+    nl_rel_tol = 1e-10
+    nl_abs_tol = 1e-8
+    nl_max_its = 10
+    l_tol = 1e-6
+    l_max_its = 300
+[]
+
+[Outputs]
+  print_linear_residuals = true
+  csv = true
+[]
@@ -0,0 +1,135 @@
+[Mesh]
+  [./bundle]
+        type = ChannelBundleMeshGenerator
+        num_channels = 20
+        nx = 50
+        xmin = 0
+        xmax = 1
+        channel_spacing = 0.1
+    [../]
+[]
+
+[Variables]
+  [./T]
+        order = FIRST
+        family = LAGRANGE
+        initial_condition = 300 # K
+  [../]
+[]
+
+[AuxVariables]
+  # Parameters for Water
+  [./rho]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 1000  # kg/m^3
+  [../]
+
+  [./cp]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 4184  # J/kg/K
+  [../]
+
+  [./K]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.6   # W/m/K
+  [../]
+
+  [./vel]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.01  # m/s
+  [../]
+
+  [./T_wall]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 400   # K
+  [../]
+
+  [./h_wall]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 50    # W/m^2/K
+  [../]
+[]
+
+[Kernels]
+  [./channel]
+    type = ChannelHeatTransport
+    variable = T
+	density = rho
+	heat_capacity = cp
+	thermal_conductivity = K
+	velocity = vel
+	convection_coeff = h_wall
+	specific_area = 400       # m^-1 (1 cm diameter channel)
+	wall_temperature = T_wall
+  [../]
+[]
+
+# Conservative Form REQUIRES flux based BC due to Gauss Divergence Therom
+[BCs]
+  [./fluxBCs]
+    type = ThermalFluidFluxBC
+    variable = T
+    boundary = 'inlet outlet'
+	density = rho
+	heat_capacity = cp
+	vel_x = vel
+	outside_temperature = 300
+  [../]
+[]
+
+[Postprocessors]
+	[./T_outlet]
+        type = SideAverageValue
+        boundary = 'outlet'
+        variable = T
+        execute_on = 'initial timestep_end'
+    [../]
+
+	[./T_avg]
+      type = ElementAverageValue
+      variable = T
+      execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+    [./SMP_Newton]
+      type = SMP
+      full = true
+      solve_type = newton
+    [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+
+  start_time = 0.0
+  end_time = 10.0
+
+  [./TimeStepper]
+    type = ConstantDT
+    dt = 1.0
+  [../]
+
+  # Each channel is a tridiagonal block, so a direct solve is cheap
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+
+  line_search = none
+  nl_rel_tol = 1e-8
+  nl_abs_tol = 1e-8
+  nl_max_its = 10
+  l_tol = 1e-6
+  l_max_its = 100
+[]
+
+[Outputs]
+  csv = true
+[]
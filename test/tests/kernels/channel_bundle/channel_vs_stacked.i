@@ -0,0 +1,199 @@
+# Checks ChannelHeatTransport against the stacked general kernels on one 1D channel
+#
+# T is solved with the closed form channel kernel, and T_ref with HeatAccumulation,
+# HeatConduction, HeatAdvectionConservative (full upwinding), and HeatConvection.
+# With the trapezoidal rule the stacked kernels lump the mass and wall exchange onto
+# the nodes, as the channel kernel does, so both temperatures must agree to the solver
+# tolerance. The run stops with an error if they do not.
+
+[Mesh]
+  [./channel]
+        type = GeneratedMeshGenerator
+        dim = 1
+        nx = 50
+        xmin = 0
+        xmax = 1
+    [../]
+[]
+
+[Variables]
+  [./T]
+        order = FIRST
+        family = LAGRANGE
+        initial_condition = 300 # K
+  [../]
+
+  [./T_ref]
+        order = FIRST
+        family = LAGRANGE
+        initial_condition = 300 # K
+  [../]
+[]
+
+[AuxVariables]
+  # Parameters for Water
+  [./rho]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 1000  # kg/m^3
+  [../]
+
+  [./cp]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 4184  # J/kg/K
+  [../]
+
+  [./K]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.6   # W/m/K
+  [../]
+
+  [./vel]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.01  # m/s
+  [../]
+
+  [./T_wall]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 400   # K
+  [../]
+
+  [./h_wall]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 50    # W/m^2/K
+  [../]
+[]
+
+[Kernels]
+  [./channel]
+    type = ChannelHeatTransport
+    variable = T
+	density = rho
+	heat_capacity = cp
+	thermal_conductivity = K
+	velocity = vel
+	convection_coeff = h_wall
+	specific_area = 400       # m^-1 (1 cm diameter channel)
+	wall_temperature = T_wall
+  [../]
+
+  [./ref_accum]
+    type = HeatAccumulation
+    variable = T_ref
+	density = rho
+	heat_capacity = cp
+  [../]
+  [./ref_cond]
+    type = HeatConduction
+    variable = T_ref
+	thermal_conductivity = K
+  [../]
+  [./ref_adv]
+    type = HeatAdvectionConservative
+    variable = T_ref
+	density = rho
+	heat_capacity = cp
+	vel_x = vel
+	upwinding_type = 'full'
+  [../]
+  [./ref_wall]
+    type = HeatConvection
+    variable = T_ref
+	coupled_temperature = T_wall
+	convection_coeff = h_wall
+	specific_area = 400
+  [../]
+[]
+
+# Conservative Form REQUIRES flux based BC due to Gauss Divergence Therom
+[BCs]
+  [./fluxBCs]
+    type = ThermalFluidFluxBC
+    variable = T
+    boundary = 'left right'
+	density = rho
+	heat_capacity = cp
+	vel_x = vel
+	outside_temperature = 300
+  [../]
+
+  [./ref_fluxBCs]
+    type = ThermalFluidFluxBC
+    variable = T_ref
+    boundary = 'left right'
+	density = rho
+	heat_capacity = cp
+	vel_x = vel
+	outside_temperature = 300
+  [../]
+[]
+
+[Postprocessors]
+	[./T_avg]
+      type = ElementAverageValue
+      variable = T
+      execute_on = 'initial timestep_end'
+  [../]
+
+	[./T_diff]
+      type = ElementL2Difference
+      variable = T
+      other_variable = T_ref
+      execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[UserObjects]
+  [./agree]
+    type = Terminator
+    expression = 'T_diff > 1e-6'
+    error_level = ERROR
+    message = 'ChannelHeatTransport differs from the stacked kernels'
+    execute_on = 'timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+    [./SMP_Newton]
+      type = SMP
+      full = true
+      solve_type = newton
+    [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+
+  start_time = 0.0
+  end_time = 10.0
+
+  [./TimeStepper]
+    type = ConstantDT
+    dt = 1.0
+  [../]
+
+  # Lumps the mass and wall exchange of the stacked kernels, as in the channel kernel
+  [./Quadrature]
+    type = TRAP
+  [../]
+
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-10
+  nl_max_its = 10
+  l_tol = 1e-10
+  l_max_its = 100
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,130 @@
+# Jacobian check of the AD heat kernels with full upwinding and the AD flux BC
+#
+# The temperature varies over the domain and the flow is oblique to the mesh, so the
+# upwind and downwind nodes differ between elements and the BC has both inflow and
+# outflow sides. Run by PetscJacobianTester.
+
+[Mesh]
+  [./my_mesh]
+        type = GeneratedMeshGenerator
+        dim = 2
+        nx = 4
+        ny = 3
+        xmin = 0
+        xmax = 1
+        ymin = 0
+        ymax = 0.5
+    [../]
+[]
+
+[Functions]
+  [./T_init]
+    type = ParsedFunction
+    expression = '300 + 100*x + 60*y' # K
+  [../]
+[]
+
+[Variables]
+  [./T]
+        order = FIRST
+        family = LAGRANGE
+        [./InitialCondition]
+            type = FunctionIC
+            function = T_init
+        [../]
+  [../]
+[]
+
+[AuxVariables]
+  # Parameters for Steel
+  [./rho]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 7750  # kg/m^3
+  [../]
+
+  [./cp]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 466  # J/kg/K
+  [../]
+
+  [./K]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 45   # W/m/K
+  [../]
+
+  [./ux]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.1   # m/s
+  [../]
+
+  [./uy]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.04  # m/s
+  [../]
+[]
+
+[Kernels]
+  [./heat_accum]
+    type = ADHeatAccumulation
+    variable = T
+	density = rho
+	heat_capacity = cp
+  [../]
+  [./heat_cond]
+    type = ADHeatConduction
+    variable = T
+	thermal_conductivity = K
+  [../]
+  [./heat_adv]
+    type = ADHeatAdvectionConservative
+    variable = T
+	density = rho
+	heat_capacity = cp
+	vel_x = ux
+	vel_y = uy
+	vel_z = 0
+	upwinding_type = 'full'
+  [../]
+[]
+
+# Conservative Form REQUIRES flux based BC due to Gauss Divergence Therom
+[BCs]
+  [./fluxBCs]
+    type = ADThermalFluidFluxBC
+    variable = T
+    boundary = 'left right top bottom'
+    density = rho
+	heat_capacity = cp
+	vel_x = ux
+	vel_y = uy
+	vel_z = 0
+	outside_temperature = 350
+  [../]
+[]
+
+[Preconditioning]
+    [./SMP]
+      type = SMP
+      full = true
+      solve_type = newton
+    [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+
+  # Two steps, so that the Jacobian is also checked with a nonzero time derivative
+  num_steps = 2
+  dt = 1.0
+
+  line_search = none
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-10
+  nl_max_its = 10
+[]
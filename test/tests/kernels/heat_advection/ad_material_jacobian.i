@@ -0,0 +1,123 @@
+# Jacobian check of the AD heat kernels and the AD flux BC with temperature dependent
+# AD material properties for fv * rho * cp and fv * K
+#
+# The temperature varies over the domain and the flow is oblique to the mesh, so the
+# upwind and downwind nodes differ between elements and the BC has both inflow and
+# outflow sides. vel_z is not given (zero). Run by PetscJacobianTester.
+
+[Mesh]
+  [./my_mesh]
+        type = GeneratedMeshGenerator
+        dim = 2
+        nx = 4
+        ny = 3
+        xmin = 0
+        xmax = 1
+        ymin = 0
+        ymax = 0.5
+    [../]
+[]
+
+[Functions]
+  [./T_init]
+    type = ParsedFunction
+    expression = '300 + 100*x + 60*y' # K
+  [../]
+[]
+
+[Variables]
+  [./T]
+        order = FIRST
+        family = LAGRANGE
+        [./InitialCondition]
+            type = FunctionIC
+            function = T_init
+        [../]
+  [../]
+[]
+
+[AuxVariables]
+  [./ux]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.1   # m/s
+  [../]
+
+  [./uy]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.04  # m/s
+  [../]
+[]
+
+[Materials]
+  # Steel with properties that change with the temperature
+  [./rho_cp_eps]
+    type = ADParsedMaterial
+    property_name = rho_cp_eps
+    coupled_variables = 'T'
+    expression = '7750 * 466 * (1 + 2e-3 * (T - 300))' # J/m^3/K
+  [../]
+  [./k_eps]
+    type = ADParsedMaterial
+    property_name = k_eps
+    coupled_variables = 'T'
+    expression = '45 * (1 - 1e-3 * (T - 300))' # W/m/K
+  [../]
+[]
+
+[Kernels]
+  [./heat_accum]
+    type = ADHeatAccumulation
+    variable = T
+	rho_cp_eps = rho_cp_eps
+  [../]
+  [./heat_cond]
+    type = ADHeatConduction
+    variable = T
+	k_eps = k_eps
+  [../]
+  [./heat_adv]
+    type = ADHeatAdvectionConservative
+    variable = T
+	rho_cp_eps = rho_cp_eps
+	vel_x = ux
+	vel_y = uy
+	upwinding_type = 'full'
+  [../]
+[]
+
+# Conservative Form REQUIRES flux based BC due to Gauss Divergence Therom
+[BCs]
+  [./fluxBCs]
+    type = ADThermalFluidFluxBC
+    variable = T
+    boundary = 'left right top bottom'
+	rho_cp_eps = rho_cp_eps
+	vel_x = ux
+	vel_y = uy
+	outside_temperature = 350
+  [../]
+[]
+
+[Preconditioning]
+    [./SMP]
+      type = SMP
+      full = true
+      solve_type = newton
+    [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+
+  # Two steps, so that the Jacobian is also checked with a nonzero time derivative
+  num_steps = 2
+  dt = 1.0
+
+  line_search = none
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-10
+  nl_max_its = 10
+[]
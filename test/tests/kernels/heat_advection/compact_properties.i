@@ -0,0 +1,216 @@
+# Thermal fluid problem with the properties stored once per element in single precision
+#
+# CompactThermalFluidProperties replaces the nodal property AuxVariables and the
+# velocity is a constant, so the only nodal field is the temperature. The density
+# changes in time, so the stored values must be recomputed at every time step.
+
+[Mesh]
+  [./my_mesh]
+        type = GeneratedMeshGenerator
+        dim = 2
+        nx = 50
+        ny = 5
+        xmin = 0
+        xmax = 1
+        ymin = 0
+        ymax = 0.1
+    [../]
+[]
+
+[Variables]
+  [./T]
+        order = FIRST
+        family = LAGRANGE
+        initial_condition = 300 # K
+  [../]
+[]
+
+[Functions]
+  # Steel with a density that drops along the channel and rises in time
+  [./rho_steel]
+    type = ParsedFunction
+    expression = '7750 - 50*x + 10*t' # kg/m^3
+  [../]
+[]
+
+[Materials]
+  # Per element single precision properties, without property variables
+  [./steel]
+    type = CompactThermalFluidProperties
+    density = rho_steel
+    heat_capacity = 466        # J/kg/K
+    thermal_conductivity = 45  # W/m/K
+  [../]
+[]
+
+[Kernels]
+  [./heat_accum]
+    type = HeatAccumulation
+    variable = T
+	rho_cp_eps = rho_cp_eps
+  [../]
+  [./heat_cond]
+    type = HeatConduction
+    variable = T
+	k_eps = k_eps
+  [../]
+  [./heat_adv]
+    type = HeatAdvectionConservative
+    variable = T
+	rho_cp_eps = rho_cp_eps
+	vel_x = 0.1 
+	vel_y = 0 
+	vel_z = 0
+	upwinding_type = 'full'
+  [../]
+[]
+
+# Conservative Form REQUIRES flux based BC due to Gauss Divergence Therom 
+[BCs]
+  [./fluxBCs]
+    type = ThermalFluidFluxBC
+    variable = T
+    boundary = 'left right'
+	rho_cp_eps = rho_cp_eps
+	vel_x = 0.1 
+	vel_y = 0 
+	vel_z = 0
+	outside_temperature = 350
+  [../]
+
+[]
+
+[Postprocessors]
+	# Integral of rho_cp_eps, which is exact for the element averages of a linear density
+	[./rho_cp_int]
+        type = ElementIntegralMaterialProperty
+        mat_prop = rho_cp_eps
+        execute_on = 'timestep_end'
+        outputs = console
+    [../]
+
+	[./time]
+        type = TimePostprocessor
+        execute_on = 'timestep_end'
+        outputs = console
+    [../]
+
+	# Relative error of the stored values (single precision, and recomputed in time)
+	[./rho_cp_err]
+        type = ParsedPostprocessor
+        expression = 'abs(rho_cp_int - 466 * 0.1 * (7750 - 25 + 10 * time)) / rho_cp_int'
+        pp_names = 'rho_cp_int time'
+        execute_on = 'timestep_end'
+        outputs = console
+    [../]
+
+	[./T_left]
+        type = SideAverageValue
+        boundary = 'left'
+        variable = T
+        execute_on = 'initial timestep_end'
+    [../]
+ 
+    [./T_right]
+        type = SideAverageValue
+        boundary = 'right'
+        variable = T
+        execute_on = 'initial timestep_end'
+    [../]
+	
+	[./T_avg]
+      type = ElementAverageValue
+      # block = NAME_OF_SUBDOMAIN  # Optional if block has different names
+      variable = T
+      execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[UserObjects]
+  [./compact_check]
+    type = Terminator
+    expression = 'rho_cp_err > 1e-6'
+    error_level = ERROR
+    message = 'The stored properties do not match the density function at the current time'
+    execute_on = 'timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+    [./SMP_PJFNK]
+      type = SMP
+      full = true
+      solve_type = newton
+    [../]
+
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  
+  start_time = 0.0
+  end_time = 15.0
+  dtmax = 1.0
+
+  [./TimeStepper]
+    type = ConstantDT
+    dt = 1.0
+  [../]
+  
+  petsc_options = '-snes_converged_reason
+
+                      -ksp_gmres_modifiedgramschmidt'
+
+    # NOTE: The sub_pc_type arg not used if pc_type is ksp,
+    #       Instead, set the ksp_ksp_type to the pc method
+    #       you want. Then, also set the ksp_pc_type to be
+    #       the terminal preconditioner.
+    #
+    # Good terminal precon options: lu, ilu, asm, gasm, pbjacobi
+    #                               bjacobi, redundant, telescope
+    petsc_options_iname ='-ksp_type
+                          -pc_type
+
+                          -sub_pc_type
+
+                          -snes_max_it
+
+                          -sub_pc_factor_shift_type
+                          -pc_asm_overlap
+
+                          -snes_atol
+                          -snes_rtol
+
+                          -ksp_ksp_type
+                          -ksp_pc_type'
+
+    # snes_max_it = maximum non-linear steps
+    petsc_options_value = 'fgmres
+                           ksp
+
+                           ilu
+
+                           10
+                           NONZERO
+                           10
+                           1E-8
+                           1E-10
+
+                           gmres
+                           ilu'
+
+    line_search = none   # none, bt, l2, basic
+    nl_rel_tol = 1e-8
+    nl_abs_tol = 1e-8
+    nl_rel_step_tol = 1e-12
+    nl_abs_step_tol = 1e-12
+    nl_max_its = 10
+    l_tol = 1e-6
+    l_max_its = 300
+[]
+
+[Outputs]
+  print_linear_residuals = true
+  csv = true
+[]
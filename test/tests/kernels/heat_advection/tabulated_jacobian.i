@@ -0,0 +1,162 @@
+# Jacobian check of the temperature derivatives of tabulated properties
+#
+# T uses the stacked kernels and T_fused the fused ThermalFluidKernel, each with its own
+# temperature dependent table. The temperature varies over the table and the flow is
+# oblique to the mesh, so every property derivative term (accumulation, conduction,
+# fully upwinded advection, and the flux BC) is nonzero. Run by PetscJacobianTester.
+
+[Mesh]
+  [./my_mesh]
+        type = GeneratedMeshGenerator
+        dim = 2
+        nx = 4
+        ny = 3
+        xmin = 0
+        xmax = 1
+        ymin = 0
+        ymax = 0.5
+    [../]
+[]
+
+[Functions]
+  [./T_init]
+    type = ParsedFunction
+    expression = '300 + 100*x + 60*y' # K
+  [../]
+[]
+
+[Variables]
+  [./T]
+        order = FIRST
+        family = LAGRANGE
+        [./InitialCondition]
+            type = FunctionIC
+            function = T_init
+        [../]
+  [../]
+
+  [./T_fused]
+        order = FIRST
+        family = LAGRANGE
+        [./InitialCondition]
+            type = FunctionIC
+            function = T_init
+        [../]
+  [../]
+[]
+
+[AuxVariables]
+  [./ux]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.1   # m/s
+  [../]
+
+  [./uy]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.04  # m/s
+  [../]
+[]
+
+[Materials]
+  # Temperature dependent parameters for Steel (the smooth spline keeps the derivative
+  # continuous for the finite differences)
+  [./steel]
+    type = TabulatedThermalFluidProperties
+    temperature = T
+    temperature_table = '250 300 350 400 450 500'               # K
+    density_table = '7780 7750 7720 7690 7660 7630'             # kg/m^3
+    heat_capacity_table = '450 466 480 492 502 510'             # J/kg/K
+    thermal_conductivity_table = '46 45 44.2 43.6 43.2 43'      # W/m/K
+    interpolation = monotone_cubic
+  [../]
+
+  [./steel_fused]
+    type = TabulatedThermalFluidProperties
+    temperature = T_fused
+    temperature_table = '250 300 350 400 450 500'               # K
+    density_table = '7780 7750 7720 7690 7660 7630'             # kg/m^3
+    heat_capacity_table = '450 466 480 492 502 510'             # J/kg/K
+    thermal_conductivity_table = '46 45 44.2 43.6 43.2 43'      # W/m/K
+    interpolation = monotone_cubic
+    rho_cp_eps_name = rho_cp_eps_fused
+    k_eps_name = k_eps_fused
+  [../]
+[]
+
+[Kernels]
+  [./heat_accum]
+    type = HeatAccumulation
+    variable = T
+	rho_cp_eps = rho_cp_eps
+  [../]
+  [./heat_cond]
+    type = HeatConduction
+    variable = T
+	k_eps = k_eps
+  [../]
+  [./heat_adv]
+    type = HeatAdvectionConservative
+    variable = T
+	rho_cp_eps = rho_cp_eps
+	vel_x = ux
+	vel_y = uy
+	upwinding_type = 'full'
+  [../]
+
+  [./thermal_fluid]
+    type = ThermalFluidKernel
+    variable = T_fused
+	rho_cp_eps = rho_cp_eps_fused
+	k_eps = k_eps_fused
+	vel_x = ux
+	vel_y = uy
+	upwinding_type = 'full'
+  [../]
+[]
+
+# Conservative Form REQUIRES flux based BC due to Gauss Divergence Therom
+[BCs]
+  [./fluxBCs]
+    type = ThermalFluidFluxBC
+    variable = T
+    boundary = 'left right top bottom'
+	rho_cp_eps = rho_cp_eps
+	vel_x = ux
+	vel_y = uy
+	outside_temperature = 350
+  [../]
+
+  [./fused_fluxBCs]
+    type = ThermalFluidFluxBC
+    variable = T_fused
+    boundary = 'left right top bottom'
+	rho_cp_eps = rho_cp_eps_fused
+	vel_x = ux
+	vel_y = uy
+	outside_temperature = 350
+  [../]
+[]
+
+[Preconditioning]
+    [./SMP]
+      type = SMP
+      full = true
+      solve_type = newton
+    [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+
+  # Two steps, so that the Jacobian is also checked with a nonzero time derivative
+  num_steps = 2
+  dt = 1.0
+
+  line_search = none
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-10
+  nl_max_its = 10
+[]
@@ -0,0 +1,146 @@
+# Explicit heat accumulation with a lumped mass matrix
+#
+# The plate is insulated and starts with a temperature gradient, so conduction
+# redistributes the energy while the uniform source adds it.  The row sums of the
+# lumped mass matrix are the integrals of the test functions, and the conduction
+# rows sum to zero, so every explicit step must raise the average temperature by
+# exactly dt * S / (rho * cp).  The run stops with an error if it does not.
+
+[Mesh]
+  [./my_mesh]
+        type = GeneratedMeshGenerator
+        dim = 2
+        nx = 10
+        ny = 10
+        xmin = 0
+        xmax = 1
+        ymin = 0
+        ymax = 1
+    [../]
+[]
+
+[Functions]
+  [./T_init]
+    type = ParsedFunction
+    expression = '300 + 100*x' # K
+  [../]
+[]
+
+[Variables]
+  [./T]
+        order = FIRST
+        family = LAGRANGE
+        [./InitialCondition]
+            type = FunctionIC
+            function = T_init
+        [../]
+  [../]
+[]
+
+[AuxVariables]
+  # Parameters for Steel
+  [./rho]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 7750  # kg/m^3
+  [../]
+
+  [./cp]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 466  # J/kg/K
+  [../]
+
+  [./K]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 45   # W/m/K
+  [../]
+
+  [./S]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 1e6   # W/m^3
+  [../]
+
+[]
+
+[Kernels]
+  [./heat_accum]
+    type = HeatAccumulation
+    variable = T
+	density = rho
+	heat_capacity = cp
+	lumped_mass = true
+  [../]
+  [./heat_cond]
+    type = HeatConduction
+    variable = T
+	thermal_conductivity = K
+  [../]
+  [./heat_source]
+    type = HeatSource
+    variable = T
+	coupled_source = S
+  [../]
+[]
+
+[Postprocessors]
+	[./T_avg]
+      type = ElementAverageValue
+      variable = T
+      execute_on = 'initial timestep_end'
+  [../]
+
+	[./T_avg_0]
+      type = ElementAverageValue
+      variable = T
+      execute_on = 'initial'
+  [../]
+
+	[./time]
+      type = TimePostprocessor
+      execute_on = 'initial timestep_end'
+  [../]
+
+  # S / (rho * cp) = 1e6 / (7750 * 466) K/s
+	[./T_avg_error]
+      type = ParsedPostprocessor
+      expression = 'abs(T_avg - T_avg_0 - time * 1e6 / (7750 * 466))'
+      pp_names = 'T_avg T_avg_0 time'
+      execute_on = 'timestep_end'
+  [../]
+[]
+
+[UserObjects]
+  [./conserved]
+    type = Terminator
+    expression = 'T_avg_error > 1e-8'
+    error_level = ERROR
+    message = 'The lumped mass matrix does not conserve the energy'
+    execute_on = 'timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  # The lumped mass matrix is diagonal, so each step is a single diagonal inverse
+  [./TimeIntegrator]
+    type = ActuallyExplicitEuler
+    solve_type = lump_preconditioned
+  [../]
+
+  start_time = 0.0
+  end_time = 10.0
+
+  # Explicit stability limit: dt < rho * cp * dx^2 / (4 K) = 200 s for this mesh
+  [./TimeStepper]
+    type = ConstantDT
+    dt = 1.0
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
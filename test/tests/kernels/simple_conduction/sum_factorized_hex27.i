@@ -0,0 +1,202 @@
+# Second order conduction on HEX27 elements with the sum factorized kernels
+#
+# T is solved with HeatAccumulation and HeatConduction, and T_sf with the sum
+# factorized kernels, which apply the same operator without forming the element
+# matrices and only assemble the diagonal of their Jacobians.  Both are solved
+# with PJFNK and a Jacobi preconditioner in the same system, so the residual of
+# the sum factorized kernels must give the same solution.  The mesh is rotated so
+# that the element map is not diagonal, and the conductivity varies in space.
+
+[Mesh]
+  [./my_mesh]
+        type = GeneratedMeshGenerator
+        dim = 3
+        nx = 4
+        ny = 4
+        nz = 4
+        xmin = 0
+        xmax = 1
+        ymin = 0
+        ymax = 1
+        zmin = 0
+        zmax = 1
+        elem_type = HEX27
+    [../]
+  [./rotate]
+        type = TransformGenerator
+        input = my_mesh
+        transform = ROTATE
+        vector_value = '30 20 10'
+    [../]
+[]
+
+[Variables]
+  [./T]
+        order = SECOND
+        family = LAGRANGE
+        initial_condition = 300 # K
+  [../]
+
+  [./T_sf]
+        order = SECOND
+        family = LAGRANGE
+        initial_condition = 300 # K
+  [../]
+[]
+
+[AuxVariables]
+  # Parameters for Steel
+  [./rho]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 7750  # kg/m^3
+  [../]
+
+  [./cp]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 466  # J/kg/K
+  [../]
+
+  [./K]
+      order = FIRST
+      family = LAGRANGE
+      [./InitialCondition]
+          type = FunctionIC
+          function = '45*(1 + 0.5*x*y)'   # W/m/K
+      [../]
+  [../]
+[]
+
+[Kernels]
+  [./heat_accum]
+    type = HeatAccumulation
+    variable = T
+	density = rho
+	heat_capacity = cp
+  [../]
+  [./heat_cond]
+    type = HeatConduction
+    variable = T
+	thermal_conductivity = K
+  [../]
+
+  [./heat_accum_sf]
+    type = SumFactorizedHeatAccumulation
+    variable = T_sf
+	density = rho
+	heat_capacity = cp
+  [../]
+  [./heat_cond_sf]
+    type = SumFactorizedHeatConduction
+    variable = T_sf
+	thermal_conductivity = K
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = T
+    boundary = 'left'
+    value = 300
+  [../]
+  [./right]
+    type = NeumannBC
+    variable = T
+    boundary = 'right'
+    value = 5e4
+  [../]
+
+  [./left_sf]
+    type = DirichletBC
+    variable = T_sf
+    boundary = 'left'
+    value = 300
+  [../]
+  [./right_sf]
+    type = NeumannBC
+    variable = T_sf
+    boundary = 'right'
+    value = 5e4
+  [../]
+[]
+
+[Postprocessors]
+    # The sum factorized solution must match the one of the standard kernels
+    [./T_diff]
+        type = ElementL2Difference
+        variable = T_sf
+        other_variable = T
+        execute_on = 'timestep_end'
+        outputs = console
+    [../]
+
+    [./T_change]
+        type = ElementL2Error
+        variable = T
+        function = 300
+        execute_on = 'timestep_end'
+        outputs = console
+    [../]
+
+    [./T_right]
+        type = SideAverageValue
+        boundary = 'right'
+        variable = T_sf
+        execute_on = 'initial timestep_end'
+    [../]
+
+    [./linear_its]
+      type = NumLinearIterations
+      execute_on = 'timestep_end'
+    [../]
+[]
+
+[UserObjects]
+  [./sum_factorized_check]
+    type = Terminator
+    expression = 'T_diff > 1e-6 * T_change'
+    error_level = ERROR
+    message = 'The sum factorized solution differs from the standard kernels'
+    execute_on = 'timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+    [./SMP_PJFNK]
+      type = SMP
+      full = true
+      solve_type = pjfnk
+    [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+
+  start_time = 0.0
+  end_time = 10.0
+  dtmax = 5.0
+
+  [./TimeStepper]
+    type = ConstantDT
+    dt = 5.0
+  [../]
+
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname = '-ksp_type -pc_type'
+  petsc_options_value = 'gmres jacobi'
+
+    line_search = none   # none, bt, l2, basic
+    nl_rel_tol = 1e-12
+    nl_abs_tol = 1e-10
+    nl_max_its = 10
+    l_tol = 1e-10
+    l_max_its = 500
+[]
+
+[Outputs]
+  print_linear_residuals = true
+  csv = true
+[]
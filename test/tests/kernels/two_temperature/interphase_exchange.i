@@ -0,0 +1,321 @@
+# Two-temperature (fluid/solid) packed channel with a single interphase exchange kernel
+#
+# The same problem as fieldsplit.i, but the pair of HeatConvection kernels is
+# replaced by one InterphaseHeatExchange kernel on Tf.  It evaluates h*A*fv once
+# per quadrature point and writes the exchange into the rows of both Tf and Ts,
+# together with the 2x2 block of exchange Jacobians.  'SMP full = true' keeps the
+# cross blocks in the preconditioning matrix, so the Newton solve is exact.
+#
+# Tf_ref and Ts_ref solve the same problem with the pair of HeatConvection kernels.
+# Both pairs must agree to the solver tolerance, and the run stops with an error if
+# they do not.
+#
+# To run with the block diagonal field split instead, use
+#   Kernels/exchange/exchange_jacobian=diagonal
+# with the FSP preconditioner of fieldsplit.i.
+
+[Mesh]
+  [./my_mesh]
+        type = GeneratedMeshGenerator
+        dim = 2
+        nx = 50
+        ny = 5
+        xmin = 0
+        xmax = 1
+        ymin = 0
+        ymax = 0.1
+    [../]
+[]
+
+[Variables]
+  [./Tf]
+        order = FIRST
+        family = LAGRANGE
+        initial_condition = 300 # K
+  [../]
+  [./Ts]
+        order = FIRST
+        family = LAGRANGE
+        initial_condition = 300 # K
+  [../]
+
+  [./Tf_ref]
+        order = FIRST
+        family = LAGRANGE
+        initial_condition = 300 # K
+  [../]
+  [./Ts_ref]
+        order = FIRST
+        family = LAGRANGE
+        initial_condition = 300 # K
+  [../]
+[]
+
+[AuxVariables]
+  # Parameters for Air
+  [./rho_f]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 1.2  # kg/m^3
+  [../]
+
+  [./cp_f]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 1000  # J/kg/K
+  [../]
+
+  [./K_f]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.025   # W/m/K
+  [../]
+
+  # Parameters for Steel
+  [./rho_s]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 7750  # kg/m^3
+  [../]
+
+  [./cp_s]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 466  # J/kg/K
+  [../]
+
+  [./K_s]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 45   # W/m/K
+  [../]
+
+  [./eps]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.4   # fluid volume fraction (-)
+  [../]
+
+  [./eps_s]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.6   # solid volume fraction (-)
+  [../]
+
+  [./ux]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 1.0   # m/s
+  [../]
+[]
+
+[Kernels]
+  # Fluid energy balance
+  [./fluid_accum]
+    type = HeatAccumulation
+    variable = Tf
+	density = rho_f
+	heat_capacity = cp_f
+	volume_frac = eps
+  [../]
+  [./fluid_cond]
+    type = HeatConduction
+    variable = Tf
+	thermal_conductivity = K_f
+	volume_frac = eps
+  [../]
+  [./fluid_adv]
+    type = HeatAdvectionConservative
+    variable = Tf
+	density = rho_f
+	heat_capacity = cp_f
+	volume_frac = eps
+	vel_x = ux
+	upwinding_type = 'full'
+  [../]
+  [./exchange]
+    type = InterphaseHeatExchange
+    variable = Tf
+	coupled_temperature = Ts
+	convection_coeff = 50
+	specific_area = 500
+	volume_frac = eps_s
+  [../]
+
+  # Solid energy balance
+  [./solid_accum]
+    type = HeatAccumulation
+    variable = Ts
+	density = rho_s
+	heat_capacity = cp_s
+	volume_frac = eps_s
+  [../]
+  [./solid_cond]
+    type = HeatConduction
+    variable = Ts
+	thermal_conductivity = K_s
+	volume_frac = eps_s
+  [../]
+
+  # Reference with the pair of HeatConvection kernels
+  [./fluid_accum_ref]
+    type = HeatAccumulation
+    variable = Tf_ref
+	density = rho_f
+	heat_capacity = cp_f
+	volume_frac = eps
+  [../]
+  [./fluid_cond_ref]
+    type = HeatConduction
+    variable = Tf_ref
+	thermal_conductivity = K_f
+	volume_frac = eps
+  [../]
+  [./fluid_adv_ref]
+    type = HeatAdvectionConservative
+    variable = Tf_ref
+	density = rho_f
+	heat_capacity = cp_f
+	volume_frac = eps
+	vel_x = ux
+	upwinding_type = 'full'
+  [../]
+  [./fluid_conv_ref]
+    type = HeatConvection
+    variable = Tf_ref
+	coupled_temperature = Ts_ref
+	convection_coeff = 50
+	specific_area = 500
+	volume_frac = eps_s
+  [../]
+  [./solid_accum_ref]
+    type = HeatAccumulation
+    variable = Ts_ref
+	density = rho_s
+	heat_capacity = cp_s
+	volume_frac = eps_s
+  [../]
+  [./solid_cond_ref]
+    type = HeatConduction
+    variable = Ts_ref
+	thermal_conductivity = K_s
+	volume_frac = eps_s
+  [../]
+  [./solid_conv_ref]
+    type = HeatConvection
+    variable = Ts_ref
+	coupled_temperature = Tf_ref
+	convection_coeff = 50
+	specific_area = 500
+	volume_frac = eps_s
+  [../]
+[]
+
+# Conservative Form REQUIRES flux based BC due to Gauss Divergence Therom
+[BCs]
+  [./fluxBCs]
+    type = ThermalFluidFluxBC
+    variable = Tf
+    boundary = 'left right'
+    density = rho_f
+	heat_capacity = cp_f
+	volume_frac = eps
+	vel_x = ux
+	outside_temperature = 350
+  [../]
+
+  [./fluxBCs_ref]
+    type = ThermalFluidFluxBC
+    variable = Tf_ref
+    boundary = 'left right'
+    density = rho_f
+	heat_capacity = cp_f
+	volume_frac = eps
+	vel_x = ux
+	outside_temperature = 350
+  [../]
+[]
+
+[Postprocessors]
+	[./Tf_right]
+        type = SideAverageValue
+        boundary = 'right'
+        variable = Tf
+        execute_on = 'initial timestep_end'
+    [../]
+
+	[./Ts_avg]
+      type = ElementAverageValue
+      variable = Ts
+      execute_on = 'initial timestep_end'
+  [../]
+
+    [./linear_its]
+      type = NumLinearIterations
+      execute_on = 'timestep_end'
+    [../]
+
+	[./Tf_diff]
+      type = ElementL2Difference
+      variable = Tf
+      other_variable = Tf_ref
+      execute_on = 'initial timestep_end'
+  [../]
+
+	[./Ts_diff]
+      type = ElementL2Difference
+      variable = Ts
+      other_variable = Ts_ref
+      execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[UserObjects]
+  [./agree]
+    type = Terminator
+    expression = 'max(Tf_diff, Ts_diff) > 1e-6'
+    error_level = ERROR
+    message = 'InterphaseHeatExchange differs from the pair of HeatConvection kernels'
+    execute_on = 'timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type -sub_pc_type -sub_pc_factor_shift_type'
+    petsc_options_value = 'asm ilu NONZERO'
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  solve_type = newton
+
+  start_time = 0.0
+  end_time = 10.0
+  dtmax = 1.0
+
+  [./TimeStepper]
+    type = ConstantDT
+    dt = 1.0
+  [../]
+
+  petsc_options = '-snes_converged_reason'
+
+    line_search = none   # none, bt, l2, basic
+    nl_rel_tol = 1e-10
+    nl_abs_tol = 1e-8
+    nl_rel_step_tol = 1e-12
+    nl_abs_step_tol = 1e-12
+    nl_max_its = 10
+    l_tol = 1e-6
+    l_max_its = 300
+[]
+
+[Outputs]
+  print_linear_residuals = true
+  csv = true
+[]
@@ -0,0 +1,143 @@
+# Jacobian check of the interphase exchange blocks of InterphaseHeatExchange
+#
+# Tf and Ts start from different temperature fields, so the exchange is nonzero and
+# both diagonal blocks and both cross blocks d(Res(Tf))/d(Ts) and d(Res(Ts))/d(Tf),
+# which the kernel writes from the rows of Tf, are compared against finite
+# differences. 'SMP full = true' keeps the cross blocks. The heat transfer coefficient
+# h is a CONSTANT MONOMIAL nonlinear variable (h = 50 + 10 * Ts / 300), so the coefficient
+# blocks are checked with columns of a different finite element type than Tf. Run by
+# PetscJacobianTester.
+
+[Mesh]
+  [./my_mesh]
+        type = GeneratedMeshGenerator
+        dim = 2
+        nx = 4
+        ny = 3
+        xmin = 0
+        xmax = 1
+        ymin = 0
+        ymax = 0.5
+    [../]
+[]
+
+[Functions]
+  [./Tf_init]
+    type = ParsedFunction
+    expression = '300 + 100*x + 60*y' # K
+  [../]
+  [./Ts_init]
+    type = ParsedFunction
+    expression = '350 - 40*x + 20*y' # K
+  [../]
+[]
+
+[Variables]
+  [./Tf]
+        order = FIRST
+        family = LAGRANGE
+        [./InitialCondition]
+            type = FunctionIC
+            function = Tf_init
+        [../]
+  [../]
+  [./Ts]
+        order = FIRST
+        family = LAGRANGE
+        [./InitialCondition]
+            type = FunctionIC
+            function = Ts_init
+        [../]
+  [../]
+
+  [./h]
+        order = CONSTANT
+        family = MONOMIAL
+        initial_condition = 60 # W/m^2/K
+  [../]
+[]
+
+[AuxVariables]
+  [./eps_s]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.6   # solid volume fraction (-)
+  [../]
+[]
+
+[Kernels]
+  [./fluid_accum]
+    type = HeatAccumulation
+    variable = Tf
+	density = 1.2
+	heat_capacity = 1000
+	volume_frac = 0.4
+  [../]
+  [./fluid_cond]
+    type = HeatConduction
+    variable = Tf
+	thermal_conductivity = 0.025
+	volume_frac = 0.4
+  [../]
+  [./exchange]
+    type = InterphaseHeatExchange
+    variable = Tf
+	coupled_temperature = Ts
+	convection_coeff = h
+	specific_area = 500
+	volume_frac = eps_s
+  [../]
+
+  [./solid_accum]
+    type = HeatAccumulation
+    variable = Ts
+	density = 7750
+	heat_capacity = 466
+	volume_frac = eps_s
+  [../]
+  [./solid_cond]
+    type = HeatConduction
+    variable = Ts
+	thermal_conductivity = 45
+	volume_frac = eps_s
+  [../]
+
+  # h - 10 * Ts / 300 = 50
+  [./h_value]
+    type = Reaction
+    variable = h
+  [../]
+  [./h_solid]
+    type = CoupledForce
+    variable = h
+    v = Ts
+    coef = 0.0333333333333
+  [../]
+  [./h_base]
+    type = BodyForce
+    variable = h
+    value = 50
+  [../]
+[]
+
+[Preconditioning]
+    [./SMP]
+      type = SMP
+      full = true
+      solve_type = newton
+    [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+
+  # Two steps, so that the Jacobian is also checked with a nonzero time derivative
+  num_steps = 2
+  dt = 1.0
+
+  line_search = none
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-10
+  nl_max_its = 10
+[]
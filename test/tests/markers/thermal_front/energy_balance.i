@@ -0,0 +1,238 @@
+# Energy balance of full upwinding on a mesh adapted to the thermal front
+#
+# The problem of thermal_front.i, with the ThermalFrontMarker only refining
+# ('coarsen = 0'), so that the projection of T onto the refined mesh keeps the
+# total energy exactly.  Full upwinding and the flux BC must then conserve the
+# energy across the hanging nodes:
+#
+#     E(t) - E(0) = - sum_steps dt * net_outflow
+#
+# where E = int(rho * cp * T) and net_outflow is the energy rate summed by the
+# flux BC (ThermalFluidEnergyFlow).  The run stops with an error if the relative
+# imbalance exceeds the solver tolerance.
+
+[Mesh]
+  [./my_mesh]
+        type = GeneratedMeshGenerator
+        dim = 2
+        nx = 20
+        ny = 2
+        xmin = 0
+        xmax = 1
+        ymin = 0
+        ymax = 0.1
+    [../]
+[]
+
+[Variables]
+  [./T]
+        order = FIRST
+        family = LAGRANGE
+        initial_condition = 300 # K
+  [../]
+[]
+
+[AuxVariables]
+  # Parameters for Steel
+  [./rho]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 7750  # kg/m^3
+  [../]
+ 
+  [./cp]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 466  # J/kg/K
+  [../]
+ 
+  [./K]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 45   # W/m/K
+  [../]
+ 
+  [./ux]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.1   # m/s
+  [../]
+ 
+  [./uy]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0   # m/s
+  [../]
+ 
+[]
+
+[Kernels]
+  [./heat_accum]
+    type = HeatAccumulation
+    variable = T
+	density = rho
+	heat_capacity = cp
+  [../]
+  [./heat_cond]
+    type = HeatConduction
+    variable = T
+	thermal_conductivity = K
+  [../]
+  [./heat_adv]
+    type = HeatAdvectionConservative
+    variable = T
+	density = rho
+	heat_capacity = cp
+	vel_x = ux
+	vel_y = uy
+	vel_z = 0
+	upwinding_type = 'full'
+  [../]
+[]
+
+# Conservative Form REQUIRES flux based BC due to Gauss Divergence Therom
+[BCs]
+  [./fluxBCs]
+    type = ThermalFluidFluxBC
+    variable = T
+    boundary = 'left right'
+    density = rho
+	heat_capacity = cp
+	vel_x = ux
+	vel_y = uy
+	vel_z = 0
+	outside_temperature = 350
+	energy_flow = true
+  [../]
+
+[]
+
+[Indicators]
+    [./front]
+        type = ThermalFrontIndicator
+        variable = T
+        vel_x = ux
+        vel_y = uy
+        density = rho
+        heat_capacity = cp
+        thermal_conductivity = K
+    [../]
+[]
+
+[Markers]
+    [./front]
+        type = ThermalFrontMarker
+        indicator = front
+        refine = 5    # K
+        coarsen = 0   # K (refine only)
+    [../]
+[]
+
+[Adaptivity]
+    marker = front
+    max_h_level = 2
+[]
+
+[Reporters]
+    [./energy]
+        type = ThermalFluidEnergyFlow
+        flux_bc = fluxBCs
+        boundary = 'left right'
+        execute_on = 'initial timestep_end'
+    [../]
+[]
+
+[Postprocessors]
+    [./T_int_0]
+        type = ElementIntegralVariablePostprocessor
+        variable = T
+        execute_on = 'initial'
+    [../]
+
+    [./T_int]
+        type = ElementIntegralVariablePostprocessor
+        variable = T
+        execute_on = 'initial timestep_end'
+    [../]
+
+    [./net_outflow]
+        type = ThermalFluidEnergyRate
+        energy_flow = 'energy/net_outflow'
+        execute_on = 'timestep_end'
+    [../]
+
+    [./dt]
+        type = TimestepSize
+        execute_on = 'timestep_end'
+    [../]
+
+    [./step_outflow]
+        type = ParsedPostprocessor
+        expression = 'dt * net_outflow'
+        pp_names = 'dt net_outflow'
+        execute_on = 'timestep_end'
+    [../]
+
+    [./total_outflow]
+        type = CumulativeValuePostprocessor
+        postprocessor = step_outflow
+        execute_on = 'timestep_end'
+    [../]
+
+    # rho * cp = 7750 * 466 J/m^3/K
+    [./imbalance]
+        type = ParsedPostprocessor
+        expression = 'abs(7750 * 466 * (T_int - T_int_0) + total_outflow) / (7750 * 466 * T_int_0)'
+        pp_names = 'T_int T_int_0 total_outflow'
+        execute_on = 'timestep_end'
+    [../]
+
+    [./num_elems]
+        type = NumElements
+        execute_on = 'initial timestep_end'
+    [../]
+[]
+
+[UserObjects]
+  [./conserved]
+    type = Terminator
+    expression = 'imbalance > 1e-6'
+    error_level = ERROR
+    message = 'Full upwinding on the adapted mesh does not conserve the energy'
+    execute_on = 'timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+    [./SMP_Newton]
+      type = SMP
+      full = true
+      solve_type = newton
+    [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+ 
+  start_time = 0.0
+  end_time = 15.0
+  dtmax = 1.0
+
+  [./TimeStepper]
+    type = ConstantDT
+    dt = 1.0
+  [../]
+ 
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+
+  line_search = none
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-8
+  nl_max_its = 10
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,210 @@
+# Fluid (sub-cycled) app of a sub-cycled fluid/solid two-temperature model
+#
+# Run from solid.i.  The solid temperature Ts and h*A*fv are transferred in at
+# the start of each solid step and held while the fluid takes its short steps.
+# ExchangedHeatAux sums the energy given to the fluid by the exchange kernel
+# over every fluid step, and is transferred back to the solid together with the
+# energy carried out by the flow.
+
+[Mesh]
+  [./my_mesh]
+        type = GeneratedMeshGenerator
+        dim = 2
+        nx = 50
+        ny = 5
+        xmin = 0
+        xmax = 1
+        ymin = 0
+        ymax = 0.1
+    [../]
+[]
+
+[Variables]
+  [./Tf]
+        order = FIRST
+        family = LAGRANGE
+        initial_condition = 300 # K
+  [../]
+[]
+
+[AuxVariables]
+  # Parameters for Air
+  [./rho_f]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 1.2  # kg/m^3
+  [../]
+
+  [./cp_f]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 1000  # J/kg/K
+  [../]
+
+  [./K_f]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.025   # W/m/K
+  [../]
+
+  [./eps]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.4   # fluid volume fraction (-)
+  [../]
+
+  [./ux]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 1.0   # m/s
+  [../]
+
+  # Transferred from the solid app
+  [./Ts]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 400   # K
+  [../]
+
+  [./hA]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 15000   # W/K/m^3
+  [../]
+
+  # Cumulative energy received from the solid (transferred to the solid app), as an
+  # element average so that it is integrated as the exchange kernel applies it
+  [./E]
+      order = CONSTANT
+      family = MONOMIAL
+      initial_condition = 0   # J/m^3
+  [../]
+[]
+
+[Kernels]
+  [./fluid_accum]
+    type = HeatAccumulation
+    variable = Tf
+	density = rho_f
+	heat_capacity = cp_f
+	volume_frac = eps
+  [../]
+  [./fluid_cond]
+    type = HeatConduction
+    variable = Tf
+	thermal_conductivity = K_f
+	volume_frac = eps
+  [../]
+  [./fluid_adv]
+    type = HeatAdvectionConservative
+    variable = Tf
+	density = rho_f
+	heat_capacity = cp_f
+	volume_frac = eps
+	vel_x = ux
+	upwinding_type = 'full'
+  [../]
+  [./fluid_exchange]
+    type = TransferredHeatExchange
+    variable = Tf
+	coupled_temperature = Ts
+	exchange_coeff = hA
+  [../]
+[]
+
+[AuxKernels]
+  [./exchanged_energy]
+    type = ExchangedHeatAux
+    variable = E
+	temperature = Tf
+	coupled_temperature = Ts
+	exchange_coeff = hA
+	execute_on = 'initial timestep_end'
+  [../]
+[]
+
+# Conservative Form REQUIRES flux based BC due to Gauss Divergence Therom
+[BCs]
+  [./fluxBCs]
+    type = ThermalFluidFluxBC
+    variable = Tf
+    boundary = 'left right'
+    density = rho_f
+	heat_capacity = cp_f
+	volume_frac = eps
+	vel_x = ux
+	outside_temperature = 300
+	energy_flow = true
+  [../]
+[]
+
+[Reporters]
+    [./energy]
+        type = ThermalFluidEnergyFlow
+        flux_bc = fluxBCs
+        boundary = 'left right'
+        execute_on = 'initial timestep_end'
+    [../]
+[]
+
+[Postprocessors]
+    # Energy carried out of the domain since the start (J per unit depth), transferred to
+    # the solid app for the energy balance of both phases
+    [./net_outflow]
+        type = ThermalFluidEnergyRate
+        energy_flow = 'energy/net_outflow'
+        execute_on = 'timestep_end'
+    [../]
+
+    [./dt]
+        type = TimestepSize
+        execute_on = 'timestep_end'
+    [../]
+
+    [./step_outflow]
+        type = ParsedPostprocessor
+        expression = 'dt * net_outflow'
+        pp_names = 'dt net_outflow'
+        execute_on = 'timestep_end'
+    [../]
+
+    [./total_outflow]
+        type = CumulativeValuePostprocessor
+        postprocessor = step_outflow
+        execute_on = 'timestep_end'
+    [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type -sub_pc_type -sub_pc_factor_shift_type'
+    petsc_options_value = 'asm ilu NONZERO'
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  solve_type = newton
+
+  start_time = 0.0
+  end_time = 20.0
+
+  [./TimeStepper]
+    type = ConstantDT
+    dt = 0.5
+  [../]
+
+    line_search = none   # none, bt, l2, basic
+    nl_rel_tol = 1e-8
+    nl_abs_tol = 1e-8
+    nl_max_its = 10
+    l_tol = 1e-6
+    l_max_its = 300
+[]
+
+[Outputs]
+  print_linear_residuals = false
+[]
@@ -0,0 +1,246 @@
+# Solid (parent) app of a sub-cycled fluid/solid two-temperature model
+#
+# The solid conducts heat with long time steps (dt = 5 s) and the fluid app
+# (fluid.i) sub-cycles with its own short steps inside each solid step.
+#   - To the fluid: the solid temperature and h*A*fv (MultiAppCopyTransfer).
+#   - From the fluid: the cumulative energy it received from the solid (ExchangedHeatAux),
+#     whose change over the solid step is removed here by TransferredHeatExchange.
+# Both apps see the same exchanged energy, so the coupling conserves energy
+# without solving the solid at the fluid time step.  The run stops with an error
+# if the total energy of both phases changes by more than the energy carried out
+# by the flow.
+
+[Mesh]
+  [./my_mesh]
+        type = GeneratedMeshGenerator
+        dim = 2
+        nx = 50
+        ny = 5
+        xmin = 0
+        xmax = 1
+        ymin = 0
+        ymax = 0.1
+    [../]
+[]
+
+[Variables]
+  [./Ts]
+        order = FIRST
+        family = LAGRANGE
+        initial_condition = 400 # K
+  [../]
+[]
+
+[AuxVariables]
+  # Parameters for Steel
+  [./rho_s]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 7750  # kg/m^3
+  [../]
+
+  [./cp_s]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 466  # J/kg/K
+  [../]
+
+  [./K_s]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 45   # W/m/K
+  [../]
+
+  [./eps_s]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 0.6   # solid volume fraction (-)
+  [../]
+
+  # h * A * fv = 50 W/m^2/K * 500 m^-1 * 0.6
+  [./hA]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 15000   # W/K/m^3
+  [../]
+
+  # Transferred from the fluid app
+  [./E_exchange]
+      order = CONSTANT
+      family = MONOMIAL
+      initial_condition = 0   # J/m^3
+  [../]
+
+  [./Tf]
+      order = FIRST
+      family = LAGRANGE
+      initial_condition = 300   # K
+  [../]
+[]
+
+[Kernels]
+  [./solid_accum]
+    type = HeatAccumulation
+    variable = Ts
+	density = rho_s
+	heat_capacity = cp_s
+	volume_frac = eps_s
+  [../]
+  [./solid_cond]
+    type = HeatConduction
+    variable = Ts
+	thermal_conductivity = K_s
+	volume_frac = eps_s
+  [../]
+  [./solid_exchange]
+    type = TransferredHeatExchange
+    variable = Ts
+	exchanged_energy = E_exchange
+  [../]
+[]
+
+[MultiApps]
+  [./fluid]
+    type = TransientMultiApp
+    input_files = 'fluid.i'
+    sub_cycling = true
+    execute_on = 'timestep_begin'
+  [../]
+[]
+
+[Transfers]
+  [./to_fluid_Ts]
+    type = MultiAppCopyTransfer
+    to_multi_app = fluid
+    source_variable = Ts
+    variable = Ts
+  [../]
+  [./to_fluid_hA]
+    type = MultiAppCopyTransfer
+    to_multi_app = fluid
+    source_variable = hA
+    variable = hA
+  [../]
+  [./from_fluid_E]
+    type = MultiAppCopyTransfer
+    from_multi_app = fluid
+    source_variable = E
+    variable = E_exchange
+  [../]
+  [./from_fluid_Tf]
+    type = MultiAppCopyTransfer
+    from_multi_app = fluid
+    source_variable = Tf
+    variable = Tf
+  [../]
+  [./from_fluid_outflow]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = fluid
+    from_postprocessor = total_outflow
+    to_postprocessor = fluid_outflow
+    reduction_type = sum
+  [../]
+[]
+
+[Postprocessors]
+	[./Ts_avg]
+      type = ElementAverageValue
+      variable = Ts
+      execute_on = 'initial timestep_end'
+  [../]
+
+	[./Tf_avg]
+      type = ElementAverageValue
+      variable = Tf
+      execute_on = 'initial timestep_end'
+  [../]
+
+    # Total energy given by the solid to the fluid since the start (J per unit depth)
+    [./exchanged_energy]
+      type = ElementIntegralVariablePostprocessor
+      variable = E_exchange
+      execute_on = 'initial timestep_end'
+    [../]
+
+    # Energy balance of both phases:
+    #   E_solid(t) + E_fluid(t) - E_solid(0) - E_fluid(0) = - energy carried out by the flow
+    # where E = int(fv * rho * cp * T), with fv * rho * cp = 0.6 * 7750 * 466 J/m^3/K for the
+    # solid and 0.4 * 1.2 * 1000 J/m^3/K for the fluid
+    [./Ts_int_0]
+      type = ElementIntegralVariablePostprocessor
+      variable = Ts
+      execute_on = 'initial'
+    [../]
+    [./Tf_int_0]
+      type = ElementIntegralVariablePostprocessor
+      variable = Tf
+      execute_on = 'initial'
+    [../]
+    [./Ts_int]
+      type = ElementIntegralVariablePostprocessor
+      variable = Ts
+      execute_on = 'initial timestep_end'
+    [../]
+    [./Tf_int]
+      type = ElementIntegralVariablePostprocessor
+      variable = Tf
+      execute_on = 'initial timestep_end'
+    [../]
+    [./fluid_outflow]
+      type = Receiver
+    [../]
+    [./imbalance]
+      type = ParsedPostprocessor
+      expression = 'abs(2166900 * (Ts_int - Ts_int_0) + 480 * (Tf_int - Tf_int_0) + fluid_outflow) / (2166900 * Ts_int_0 + 480 * Tf_int_0)'
+      pp_names = 'Ts_int Ts_int_0 Tf_int Tf_int_0 fluid_outflow'
+      execute_on = 'timestep_end'
+    [../]
+[]
+
+[UserObjects]
+  [./conserved]
+    type = Terminator
+    expression = 'imbalance > 1e-6'
+    error_level = ERROR
+    message = 'The sub-cycled exchange does not conserve the energy of both phases'
+    execute_on = 'timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type -sub_pc_type -sub_pc_factor_shift_type'
+    petsc_options_value = 'asm ilu NONZERO'
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  solve_type = newton
+
+  start_time = 0.0
+  end_time = 20.0
+  dtmax = 5.0
+
+  [./TimeStepper]
+    type = ConstantDT
+    dt = 5.0
+  [../]
+
+  petsc_options = '-snes_converged_reason'
+
+    line_search = none   # none, bt, l2, basic
+    nl_rel_tol = 1e-8
+    nl_abs_tol = 1e-8
+    nl_max_its = 10
+    l_tol = 1e-6
+    l_max_its = 300
+[]
+
+[Outputs]
+  print_linear_residuals = true
+  csv = true
+[]
@@ -0,0 +1,92 @@
+# Linear transient conduction with constant (auxiliary variable) properties
+#
+# The Jacobian only depends on dt, so LinearJacobianReuse assembles and
+# factors it in the first step and reuses it in every later step.
+
+[Mesh]
+  [./gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 20
+    ny = 20
+  [../]
+[]
+
+[Variables]
+  [./T]
+    initial_condition = 300 # K
+  [../]
+[]
+
+[AuxVariables]
+  [./rho]
+    initial_condition = 7750 # kg/m^3
+  [../]
+  [./cp]
+    initial_condition = 466 # J/kg/K
+  [../]
+  [./K]
+    initial_condition = 45 # W/m/K
+  [../]
+[]
+
+[Kernels]
+  [./accum]
+    type = HeatAccumulation
+    variable = T
+    density = rho
+    heat_capacity = cp
+  [../]
+  [./cond]
+    type = HeatConduction
+    variable = T
+    thermal_conductivity = K
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = T
+    boundary = 'left'
+    value = 300
+  [../]
+  [./right]
+    type = NeumannBC
+    variable = T
+    boundary = 'right'
+    value = 5e4
+  [../]
+[]
+
+[UserObjects]
+  [./reuse]
+    type = LinearJacobianReuse
+    verbose = true
+  [../]
+[]
+
+[Postprocessors]
+  [./T_avg]
+    type = ElementAverageValue
+    variable = T
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  num_steps = 5
+  dt = 10
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_abs_tol = 1e-8
+[]
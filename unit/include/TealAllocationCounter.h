@@ -0,0 +1,23 @@
+/*!
+ *  \file TealAllocationCounter.h
+ *  \brief Count of heap allocations made by the unit test executable
+ *  \details This file declares a counter of the calls to the global operator new.
+ *            The unit executable replaces the global allocation functions so that
+ *            the kernel timing harness can report the number of allocations made
+ *            per residual or Jacobian evaluation. The counter is thread safe, but
+ *            counts the allocations of every thread.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/14/2026
+ *  \copyright This harness was designed and built by Austin Ladshaw (2023)
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace TealAllocationCounter
+{
+/// Number of calls to the global operator new (and new[]) since the program started
+std::size_t count();
+}
@@ -0,0 +1,283 @@
+# Single element problem for the kernel timing harness (unit/src/TealKernelTiming.C)
+#
+# Every teal kernel and BC acts on one element so that the harness can call
+# computeResidual, computeJacobian and computeOffDiagJacobian on each object
+# directly, without the PETSc solve around them. The coupled fields vary in
+# space so that the upwinding branches and the Jacobian entries are realistic.
+# Nonlinear velocity and solid temperature give off-diagonal blocks to time.
+#
+# The harness selects the element on the command line, e.g.
+#
+#   Mesh/gen/dim=3 Mesh/gen/elem_type=HEX27 order=SECOND
+#
+# The problem is only set up, never solved.
+
+order = FIRST
+
+[Mesh]
+  [./gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 1
+    ny = 1
+    nz = 1
+    xmax = 0.01
+    ymax = 0.01
+    zmax = 0.01
+    elem_type = QUAD4
+  [../]
+[]
+
+[Variables]
+  [./Tf]
+    order = ${order}
+  [../]
+  [./Ts]
+    order = ${order}
+  [../]
+  [./ux]
+    order = ${order}
+  [../]
+[]
+
+[AuxVariables]
+  [./rho]
+    order = ${order}
+  [../]
+  [./cp]
+    order = ${order}
+  [../]
+  [./K]
+    order = ${order}
+  [../]
+  [./eps]
+    order = ${order}
+  [../]
+  [./uy]
+    order = ${order}
+  [../]
+  [./uz]
+    order = ${order}
+  [../]
+  [./Q]
+    order = ${order}
+  [../]
+[]
+
+[Functions]
+  [./fluid_temp]
+    type = ParsedFunction
+    expression = '300 + 5000*x + 2000*y + 1000*z'
+  [../]
+  [./solid_temp]
+    type = ParsedFunction
+    expression = '320 - 3000*x + 1000*y'
+  [../]
+  [./vel_x]
+    type = ParsedFunction
+    expression = '0.1 + 2*y'
+  [../]
+  [./vel_y]
+    type = ParsedFunction
+    expression = '-0.05 + 3*x'
+  [../]
+  [./vel_z]
+    type = ParsedFunction
+    expression = '0.02 - 1*x'
+  [../]
+  [./density]
+    type = ParsedFunction
+    expression = '1000 - 100*x'
+  [../]
+  [./heat_source]
+    type = ParsedFunction
+    expression = '1e5*(1 + 50*x*y)'
+  [../]
+[]
+
+[ICs]
+  [./Tf_ic]
+    type = FunctionIC
+    variable = Tf
+    function = fluid_temp
+  [../]
+  [./Ts_ic]
+    type = FunctionIC
+    variable = Ts
+    function = solid_temp
+  [../]
+  [./ux_ic]
+    type = FunctionIC
+    variable = ux
+    function = vel_x
+  [../]
+  [./uy_ic]
+    type = FunctionIC
+    variable = uy
+    function = vel_y
+  [../]
+  [./uz_ic]
+    type = FunctionIC
+    variable = uz
+    function = vel_z
+  [../]
+  [./rho_ic]
+    type = FunctionIC
+    variable = rho
+    function = density
+  [../]
+  [./cp_ic]
+    type = ConstantIC
+    variable = cp
+    value = 4000 # J/kg/K
+  [../]
+  [./K_ic]
+    type = ConstantIC
+    variable = K
+    value = 0.6 # W/m/K
+  [../]
+  [./eps_ic]
+    type = ConstantIC
+    variable = eps
+    value = 0.4
+  [../]
+  [./Q_ic]
+    type = FunctionIC
+    variable = Q
+    function = heat_source
+  [../]
+[]
+
+[Kernels]
+  [./accum]
+    type = HeatAccumulation
+    variable = Tf
+    density = rho
+    heat_capacity = cp
+    volume_frac = eps
+  [../]
+  [./cond]
+    type = HeatConduction
+    variable = Tf
+    thermal_conductivity = K
+    volume_frac = eps
+  [../]
+  [./adv_none]
+    type = HeatAdvectionConservative
+    variable = Tf
+    density = rho
+    heat_capacity = cp
+    volume_frac = eps
+    vel_x = ux
+    vel_y = uy
+    vel_z = uz
+    upwinding_type = 'none'
+  [../]
+  [./adv_full]
+    type = HeatAdvectionConservative
+    variable = Tf
+    density = rho
+    heat_capacity = cp
+    volume_frac = eps
+    vel_x = ux
+    vel_y = uy
+    vel_z = uz
+    upwinding_type = 'full'
+  [../]
+  [./conv]
+    type = HeatConvection
+    variable = Tf
+    coupled_temperature = Ts
+    convection_coeff = 50
+    specific_area = 500
+    volume_frac = eps
+  [../]
+  [./exchange]
+    type = InterphaseHeatExchange
+    variable = Tf
+    coupled_temperature = Ts
+    convection_coeff = 50
+    specific_area = 500
+    volume_frac = eps
+  [../]
+  [./source]
+    type = HeatSource
+    variable = Ts
+    coupled_source = Q
+  [../]
+  [./thermal_fluid]
+    type = ThermalFluidKernel
+    variable = Tf
+    density = rho
+    heat_capacity = cp
+    thermal_conductivity = K
+    volume_frac = eps
+    vel_x = ux
+    vel_y = uy
+    vel_z = uz
+    upwinding_type = 'full'
+  [../]
+
+  [./ad_accum]
+    type = ADHeatAccumulation
+    variable = Ts
+    density = rho
+    heat_capacity = cp
+  [../]
+  [./ad_cond]
+    type = ADHeatConduction
+    variable = Ts
+    thermal_conductivity = K
+  [../]
+  [./ad_adv_full]
+    type = ADHeatAdvectionConservative
+    variable = Ts
+    density = rho
+    heat_capacity = cp
+    vel_x = ux
+    vel_y = uy
+    vel_z = uz
+    upwinding_type = 'full'
+  [../]
+[]
+
+[BCs]
+  [./flux]
+    type = ThermalFluidFluxBC
+    variable = Tf
+    boundary = 'left'
+    density = rho
+    heat_capacity = cp
+    volume_frac = eps
+    vel_x = ux
+    vel_y = uy
+    vel_z = uz
+    outside_temperature = 350
+  [../]
+  [./ad_flux]
+    type = ADThermalFluidFluxBC
+    variable = Ts
+    boundary = 'left'
+    density = rho
+    heat_capacity = cp
+    vel_x = ux
+    vel_y = uy
+    vel_z = uz
+    outside_temperature = 350
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  num_steps = 1
+  dt = 1.0
+[]